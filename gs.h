@@ -724,10 +724,60 @@ typedef bool32_t          bool32;
 
 //=== Logging ===//
 
-#define gs_log_info(MESSAGE, ...) gs_println("LOG::%s::%s(%zu)::" MESSAGE, __FILE__, __FUNCTION__, __LINE__, ##__VA_ARGS__)
-#define gs_log_success(MESSAGE, ...) gs_println("SUCCESS::%s::%s(%zu)::" MESSAGE, __FILE__, __FUNCTION__, __LINE__, ##__VA_ARGS__)
-#define gs_log_warning(MESSAGE, ...) gs_println("WARNING::%s::%s(%zu)::" MESSAGE, __FILE__, __FUNCTION__, __LINE__, ##__VA_ARGS__)
-#define gs_log_error(MESSAGE, ...) do {gs_println("ERROR::%s::%s(%zu)::" MESSAGE, __FILE__, __FUNCTION__, __LINE__, ##__VA_ARGS__);\
+/*
+    All logging (gs_println, gs_log_*) goes through the logger. gs_println is never filtered by level. Until gs_log_init() is called, 
+    records are formatted and written synchronously to the console. With desc.async set, records are 
+    pre-formatted on the calling thread into a per-thread lock-free ring and written to the sinks by 
+    a background flush thread. A full ring drops the record (see gs_log_dropped()) rather than 
+    blocking the caller. Error records are flushed synchronously before returning.
+*/
+
+#ifndef GS_LOG_RECORD_SIZE
+    #define GS_LOG_RECORD_SIZE      512     // Max formatted bytes per async record (longer records are truncated)
+#endif
+
+#ifndef GS_LOG_RING_SIZE
+    #define GS_LOG_RING_SIZE        512     // Default records per thread ring (power of two)
+#endif
+
+#ifndef GS_LOG_MAX_THREADS
+    #define GS_LOG_MAX_THREADS      64      // Threads beyond this log synchronously
+#endif
+
+#ifndef GS_LOG_FLUSH_INTERVAL_MS
+    #define GS_LOG_FLUSH_INTERVAL_MS 4      // Max latency before the flush thread drains the rings
+#endif
+
+typedef enum gs_log_level
+{
+    GS_LOG_LEVEL_INFO = 0x00,
+    GS_LOG_LEVEL_SUCCESS,
+    GS_LOG_LEVEL_WARNING,
+    GS_LOG_LEVEL_ERROR,
+    GS_LOG_LEVEL_NONE       // Filters everything
+} gs_log_level;
+
+typedef struct gs_log_desc_t
+{
+    gs_log_level level;     // Minimum severity written to sinks
+    const char* file_path;  // Optional file sink (appended to)
+    bool32_t no_console;    // Disable console sink
+    bool32_t async;         // Write records from a background flush thread
+    uint32_t ring_size;     // Records per thread ring, rounded up to a power of two (default GS_LOG_RING_SIZE)
+} gs_log_desc_t;
+
+GS_API_DECL void gs_log_init(const gs_log_desc_t* desc);
+GS_API_DECL void gs_log_shutdown();
+GS_API_DECL void gs_log_write(gs_log_level level, const char* fmt, ...);
+GS_API_DECL void gs_log_print(const char* fmt, ...);    // Info record that ignores the level filter (gs_println)
+GS_API_DECL void gs_log_flush();
+GS_API_DECL void gs_log_set_level(gs_log_level level);
+GS_API_DECL uint32_t gs_log_dropped();
+
+#define gs_log_info(MESSAGE, ...) gs_log_write(GS_LOG_LEVEL_INFO, "LOG::%s::%s(%zu)::" MESSAGE, __FILE__, __FUNCTION__, (size_t)__LINE__, ##__VA_ARGS__)
+#define gs_log_success(MESSAGE, ...) gs_log_write(GS_LOG_LEVEL_SUCCESS, "SUCCESS::%s::%s(%zu)::" MESSAGE, __FILE__, __FUNCTION__, (size_t)__LINE__, ##__VA_ARGS__)
+#define gs_log_warning(MESSAGE, ...) gs_log_write(GS_LOG_LEVEL_WARNING, "WARNING::%s::%s(%zu)::" MESSAGE, __FILE__, __FUNCTION__, (size_t)__LINE__, ##__VA_ARGS__)
+#define gs_log_error(MESSAGE, ...) do {gs_log_write(GS_LOG_LEVEL_ERROR, "ERROR::%s::%s(%zu)::" MESSAGE, __FILE__, __FUNCTION__, (size_t)__LINE__, ##__VA_ARGS__);\
                                         gs_assert(false);\
                                     } while (0)
 
@@ -1386,11 +1436,7 @@ void gs_util_normalize_path
 
 #endif
 
-#define gs_println(__FMT, ...)\
-    do {\
-        gs_printf(__FMT, ## __VA_ARGS__);\
-        gs_printf("\n");\
-    } while (0)
+#define gs_println(__FMT, ...) gs_log_print(__FMT, ## __VA_ARGS__)
 
 #ifndef gs_fprintf
     gs_force_inline
@@ -1533,6 +1579,51 @@ uint64_t gs_hash_str64(const char* str)
     return (hash1 >> 0) * 4096 + (hash2 >> 0);
 }
 
+/* 
+    Compile-time gs_hash_str64 for string literals. 
+    C++: constexpr. C: a constant expression the compiler folds (identical to gs_hash_str64 for literals up to 64 chars).
+*/
+#ifdef __cplusplus
+
+constexpr uint32_t 
+_gs_hash_str64_ct_step(const char* str, size_t i, uint32_t hash)
+{
+    return i ? _gs_hash_str64_ct_step(str, i - 1, (uint32_t)((hash * 33u) ^ (uint32_t)str[i - 1])) : hash;
+}
+
+template <size_t N>
+constexpr uint64_t 
+gs_hash_str64_ct(const char (&str)[N])
+{
+    return (uint64_t)(uint32_t)(_gs_hash_str64_ct_step(str, N - 1, 5381u) * 4096u + _gs_hash_str64_ct_step(str, N - 1, 52711u));
+}
+
+template <uint64_t V>
+struct _gs_ct_u64 {static const uint64_t value = V;};
+
+#else
+
+#define _GS_HSCT_L(S)           (sizeof(S) - 1)
+#define _GS_HSCT_C(S, I)        ((I) < _GS_HSCT_L(S) ? (uint32_t)(S)[(I) < _GS_HSCT_L(S) ? _GS_HSCT_L(S) - 1 - (I) : 0] : 0u)
+#define _GS_HSCT_1(S, I, H)     ((uint32_t)(((H) * ((I) < _GS_HSCT_L(S) ? 33u : 1u)) ^ _GS_HSCT_C(S, I)))
+#define _GS_HSCT_4(S, I, H)     _GS_HSCT_1(S, (I) + 3, _GS_HSCT_1(S, (I) + 2, _GS_HSCT_1(S, (I) + 1, _GS_HSCT_1(S, (I), H))))
+#define _GS_HSCT_16(S, I, H)    _GS_HSCT_4(S, (I) + 12, _GS_HSCT_4(S, (I) + 8, _GS_HSCT_4(S, (I) + 4, _GS_HSCT_4(S, (I), H))))
+#define _GS_HSCT_64(S, H)       _GS_HSCT_16(S, 48, _GS_HSCT_16(S, 32, _GS_HSCT_16(S, 16, _GS_HSCT_16(S, 0, H))))
+
+#define gs_hash_str64_ct(S)\
+    ((uint64_t)(uint32_t)(_GS_HSCT_64(S, 5381u) * 4096u + _GS_HSCT_64(S, 52711u)))
+
+#endif
+
+// Unique id for a type, computed at compile time (same value as gs_hash_str64(gs_to_str(T)))
+#ifdef __cplusplus
+    #define gs_type_id(T) (_gs_ct_u64<gs_hash_str64_ct(#T)>::value)
+#else
+    // The C version only folds the first 64 chars, so longer type names fail to compile rather than mismatch
+    #define _gs_type_id_len_check(S) (sizeof(char[(sizeof(S) - 1 <= 64) ? 1 : -1]) * 0)
+    #define gs_type_id(T) (gs_hash_str64_ct(#T) + _gs_type_id_len_check(#T))
+#endif
+
 gs_force_inline
 bool gs_compare_bytes(void* b0, void* b1, size_t len)
 {
@@ -1665,10 +1756,98 @@ size_t gs_hash_bytes(void *p, size_t len, size_t seed)
 #pragma warning(pop)
 #endif
 
+// Fast, non-cryptographic 64-bit hash for non-adversarial keys (not seeded against hash flooding like SipHash)
+// Adapted from wyhash (final version 4) by Wang Yi: https://github.com/wangyi-fudan/wyhash (public domain)
+#if (defined _MSC_VER && defined _M_X64 && !defined __clang__)
+    #include <intrin.h>
+    #pragma intrinsic(_umul128)
+#endif
+
+gs_force_inline 
+void _gs_hash_wymum(uint64_t* a, uint64_t* b)
+{
+#if (defined __SIZEOF_INT128__)
+    __uint128_t r = *a; r *= *b;
+    *a = (uint64_t)r; *b = (uint64_t)(r >> 64);
+#elif (defined _MSC_VER && defined _M_X64 && !defined __clang__)
+    *a = _umul128(*a, *b, b);
+#else
+    uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b, hi, lo;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = t < rl;
+    lo = t + (rm1 << 32); c += lo < t; hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    *a = lo; *b = hi;
+#endif
+}
+
+gs_force_inline 
+uint64_t _gs_hash_wymix(uint64_t a, uint64_t b)
+{
+    _gs_hash_wymum(&a, &b);
+    return a ^ b;
+}
+
+gs_force_inline uint64_t _gs_hash_wyr8(const uint8_t* p) {uint64_t v; memcpy(&v, p, 8); return v;}
+gs_force_inline uint64_t _gs_hash_wyr4(const uint8_t* p) {uint32_t v; memcpy(&v, p, 4); return v;}
+gs_force_inline uint64_t _gs_hash_wyr3(const uint8_t* p, size_t k) {return (((uint64_t)p[0]) << 16) | (((uint64_t)p[k >> 1]) << 8) | p[k - 1];}
+
+gs_force_inline
+uint64_t gs_hash_bytes_fast64(const void* data, size_t len, uint64_t seed)
+{
+    const uint64_t s0 = UINT64_C(0x2d358dccaa6c78a5), s1 = UINT64_C(0x8bb84b93962eacc9);
+    const uint64_t s2 = UINT64_C(0x4b33a62ed433d4a3), s3 = UINT64_C(0x4d5a2da51de1aa47);
+    const uint8_t* p = (const uint8_t*)data;
+    uint64_t a, b;
+    seed ^= _gs_hash_wymix(seed ^ s0, s1);
+    if (len <= 16) {
+        if (len >= 4) {
+            a = (_gs_hash_wyr4(p) << 32) | _gs_hash_wyr4(p + ((len >> 3) << 2));
+            b = (_gs_hash_wyr4(p + len - 4) << 32) | _gs_hash_wyr4(p + len - 4 - ((len >> 3) << 2));
+        }
+        else if (len > 0) {a = _gs_hash_wyr3(p, len); b = 0;}
+        else {a = b = 0;}
+    }
+    else {
+        size_t i = len;
+        if (i > 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = _gs_hash_wymix(_gs_hash_wyr8(p) ^ s1, _gs_hash_wyr8(p + 8) ^ seed);
+                see1 = _gs_hash_wymix(_gs_hash_wyr8(p + 16) ^ s2, _gs_hash_wyr8(p + 24) ^ see1);
+                see2 = _gs_hash_wymix(_gs_hash_wyr8(p + 32) ^ s3, _gs_hash_wyr8(p + 40) ^ see2);
+                p += 48; i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = _gs_hash_wymix(_gs_hash_wyr8(p) ^ s1, _gs_hash_wyr8(p + 8) ^ seed);
+            i -= 16; p += 16;
+        }
+        a = _gs_hash_wyr8(p + i - 16); 
+        b = _gs_hash_wyr8(p + i - 8);
+    }
+    a ^= s1; b ^= seed;
+    _gs_hash_wymum(&a, &b);
+    return _gs_hash_wymix(a ^ s0 ^ len, b ^ s1);
+}
+
+// Same signature as gs_hash_bytes, so it can be selected for hash tables (see gs_hash_table_set_hash_func)
+gs_force_inline
+size_t gs_hash_bytes_fast(void* p, size_t len, size_t seed)
+{
+    return (size_t)gs_hash_bytes_fast64(p, len, (uint64_t)seed);
+}
+
+typedef size_t (* gs_hash_bytes_func)(void* p, size_t len, size_t seed);
+
 /* Resource Loading Util */
 GS_API_DECL bool32_t gs_util_load_texture_data_from_file(const char* file_path, int32_t* width, int32_t* height, uint32_t* num_comps, void** data, bool32_t flip_vertically_on_load);
 GS_API_DECL bool32_t gs_util_load_texture_data_from_memory(const void* memory, size_t sz, int32_t* width, int32_t* height, uint32_t* num_comps, void** data, bool32_t flip_vertically_on_load);
 
+/* Compression Util (byte-oriented LZ77, LZ4-style sequences, 64KB window) */
+GS_API_DECL size_t gs_util_lz_compress_bound(size_t sz);
+GS_API_DECL size_t gs_util_lz_compress(const void* src, size_t src_sz, void* dst, size_t dst_cap);   // Returns compressed size, 0 if it does not fit in dst_cap
+GS_API_DECL size_t gs_util_lz_decompress(const void* src, size_t src_sz, void* dst, size_t dst_sz);  // Returns decompressed size, 0 on corrupt input
+
 /** @} */ // end of gs_util
 
 /*========================
@@ -1906,6 +2085,7 @@ typedef enum gs_hash_table_entry_state
         size_t stride;\
         size_t klpvl;\
         size_t tmp_idx;\
+        gs_hash_bytes_func hash_func;\
     }*
 
 // Need a way to create a temporary key so I can take the address of it
@@ -1933,6 +2113,20 @@ __gs_hash_table_init_impl(void** ht, size_t sz);
         (__HT)->klpvl = (size_t)(klpvl);\
     } while (0)
 
+// Hash function used for keys (defaults to gs_hash_bytes if null)
+#define gs_hash_table_hash_func(__HT)\
+    ((__HT)->hash_func ? (__HT)->hash_func : gs_hash_bytes)
+
+// Select hash function for table keys, ie. gs_hash_bytes_fast for non-adversarial keys. Must be set while table is empty.
+#define gs_hash_table_set_hash_func(__HT, __K, __V, __FUNC)\
+    do {\
+        if ((__HT) == NULL) {\
+            gs_hash_table_init((__HT), __K, __V);\
+        }\
+        gs_assert(gs_hash_table_empty(__HT));\
+        (__HT)->hash_func = (__FUNC);\
+    } while (0)
+
 #define gs_hash_table_reserve(_HT, _KT, _VT, _CT)\
     do {\
         if ((_HT) == NULL) {\
@@ -2001,37 +2195,66 @@ __gs_hash_table_init_impl(void** ht, size_t sz);
             for (uint32_t __I = __CAP; __I < NEW_CAP; ++__I) {\
                 (__HT)->data[__I].state = GS_HASH_TABLE_ENTRY_INACTIVE;\
             }\
+            /* Existing keys have to be moved onto their probe chains for the new capacity */\
+            gs_hash_table_rehash_func((void*)(__HT)->data, __CAP, gs_hash_table_capacity(__HT), sizeof((__HT)->tmp_key), (__HT)->stride, (__HT)->klpvl, (__HT)->hash_func);\
             __CAP = gs_hash_table_capacity(__HT);\
         }\
     \
         /* Get hash of key */\
         (__HT)->tmp_key = (__HMK);\
-        size_t __HSH = gs_hash_bytes((void*)&((__HT)->tmp_key), sizeof((__HT)->tmp_key), GS_HASH_TABLE_HASH_SEED);\
+        size_t __HSH = gs_hash_table_hash_func(__HT)((void*)&((__HT)->tmp_key), sizeof((__HT)->tmp_key), GS_HASH_TABLE_HASH_SEED);\
         size_t __HSH_IDX = __HSH % __CAP;\
-        (__HT)->tmp_key = (__HT)->data[__HSH_IDX].key;\
         uint32_t c = 0;\
     \
-        /* Find valid idx and place data */\
+        /* Find valid idx and place data (compare keys directly, rather than rehashing each probed key) */\
         while (\
             c < __CAP\
-            && __HSH != gs_hash_bytes((void*)&(__HT)->tmp_key, sizeof((__HT)->tmp_key), GS_HASH_TABLE_HASH_SEED)\
-            && (__HT)->data[__HSH_IDX].state == GS_HASH_TABLE_ENTRY_ACTIVE)\
+            && (__HT)->data[__HSH_IDX].state == GS_HASH_TABLE_ENTRY_ACTIVE\
+            && !gs_compare_bytes((void*)&(__HT)->data[__HSH_IDX].key, (void*)&(__HT)->tmp_key, sizeof((__HT)->tmp_key)))\
         {\
             __HSH_IDX = ((__HSH_IDX + 1) % __CAP);\
-            (__HT)->tmp_key = (__HT)->data[__HSH_IDX].key;\
             ++c;\
         }\
-        (__HT)->data[__HSH_IDX].key = (__HMK);\
+        bool __EXISTS = (__HT)->data[__HSH_IDX].state == GS_HASH_TABLE_ENTRY_ACTIVE;\
+        (__HT)->data[__HSH_IDX].key = (__HT)->tmp_key;\
         (__HT)->data[__HSH_IDX].val = (__HMV);\
         (__HT)->data[__HSH_IDX].state = GS_HASH_TABLE_ENTRY_ACTIVE;\
-        gs_dyn_array_head((__HT)->data)->size++;\
+        if (!__EXISTS) gs_dyn_array_head((__HT)->data)->size++;\
     } while (0)
 
 // Need size difference between two entries
 // Need size of key + val
 
+// Re-places all active entries of a table grown from old_cap to new_cap slots
+gs_force_inline
+void gs_hash_table_rehash_func(void* data, uint32_t old_cap, uint32_t new_cap, size_t key_len, size_t stride, size_t klpvl, gs_hash_bytes_func hash_func)
+{
+    if (!data || !old_cap) return;
+
+    char* entries = (char*)data;
+    char* old = (char*)gs_malloc(old_cap * stride);
+    memcpy(old, entries, old_cap * stride);
+    for (uint32_t i = 0; i < new_cap; ++i) {
+        *(gs_hash_table_entry_state*)(entries + i * stride + klpvl) = GS_HASH_TABLE_ENTRY_INACTIVE;
+    }
+
+    // Keys lead each entry, so they hash the same as the inserted key
+    for (uint32_t i = 0; i < old_cap; ++i)
+    {
+        char* e = old + i * stride;
+        if (*(gs_hash_table_entry_state*)(e + klpvl) != GS_HASH_TABLE_ENTRY_ACTIVE) continue;
+        size_t idx = (size_t)(hash_func ? hash_func : gs_hash_bytes)(e, key_len, GS_HASH_TABLE_HASH_SEED) % new_cap;
+        while (*(gs_hash_table_entry_state*)(entries + idx * stride + klpvl) == GS_HASH_TABLE_ENTRY_ACTIVE) {
+            idx = (idx + 1) % new_cap;
+        }
+        memcpy(entries + idx * stride, e, stride);
+    }
+
+    gs_free(old);
+}
+
 gs_force_inline
-uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len, size_t val_len, size_t stride, size_t klpvl)
+uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len, size_t val_len, size_t stride, size_t klpvl, gs_hash_bytes_func hash_func)
 {
     if (!data || !key) return GS_HASH_TABLE_INVALID_INDEX;
 
@@ -2041,7 +2264,7 @@ uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len
 	uint32_t size = gs_dyn_array_size(*data);
 	if (!capacity || !size) return (size_t)GS_HASH_TABLE_INVALID_INDEX;
     size_t idx = (size_t)GS_HASH_TABLE_INVALID_INDEX;
-    size_t hash = (size_t)gs_hash_bytes(key, key_len, GS_HASH_TABLE_HASH_SEED);
+    size_t hash = (size_t)(hash_func ? hash_func : gs_hash_bytes)(key, key_len, GS_HASH_TABLE_HASH_SEED);
     size_t hash_idx = (hash % capacity);
 
     // Iterate through data 
@@ -2049,10 +2272,8 @@ uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len
     {
         size_t offset = (i * stride);
         void* k = ((char*)(*data) + (offset));  
-        size_t kh = gs_hash_bytes(k, key_len, GS_HASH_TABLE_HASH_SEED);
-        bool comp = gs_compare_bytes(k, key, key_len);
         gs_hash_table_entry_state state = *(gs_hash_table_entry_state*)((char*)(*data) + offset + (klpvl)); 
-        if (comp && hash == kh && state == GS_HASH_TABLE_ENTRY_ACTIVE) {
+        if (state == GS_HASH_TABLE_ENTRY_ACTIVE && gs_compare_bytes(k, key, key_len)) {
             idx = i;
             break;
         }
@@ -2073,22 +2294,22 @@ uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len
     ((__HT)->tmp_key = (__HTK),\
         (gs_hash_table_geti((__HT),\
             gs_hash_table_get_key_index_func((void**)&(__HT)->data, (void*)&((__HT)->tmp_key),\
-                sizeof((__HT)->tmp_key), sizeof((__HT)->tmp_val), (__HT)->stride, (__HT)->klpvl)))) 
+                sizeof((__HT)->tmp_key), sizeof((__HT)->tmp_val), (__HT)->stride, (__HT)->klpvl, (__HT)->hash_func)))) 
 
 #define gs_hash_table_getp(__HT, __HTK)\
     (\
         (__HT)->tmp_key = (__HTK),\
         ((__HT)->tmp_idx = (uint32_t)gs_hash_table_get_key_index_func((void**)&(__HT->data), (void*)&(__HT->tmp_key), sizeof(__HT->tmp_key),\
-            sizeof(__HT->tmp_val), __HT->stride, __HT->klpvl)),\
+            sizeof(__HT->tmp_val), __HT->stride, __HT->klpvl, __HT->hash_func)),\
         ((__HT)->tmp_idx != GS_HASH_TABLE_INVALID_INDEX ? &gs_hash_table_geti((__HT), (__HT)->tmp_idx) : NULL)\
     )
 
 #define _gs_hash_table_key_exists_internal(__HT, __HTK)\
     ((__HT)->tmp_key = (__HTK),\
         (gs_hash_table_get_key_index_func((void**)&(__HT->data), (void*)&(__HT->tmp_key), sizeof(__HT->tmp_key),\
-            sizeof(__HT->tmp_val), __HT->stride, __HT->klpvl) != GS_HASH_TABLE_INVALID_INDEX))
+            sizeof(__HT->tmp_val), __HT->stride, __HT->klpvl, __HT->hash_func) != GS_HASH_TABLE_INVALID_INDEX))
 
-// uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len, size_t val_len, size_t stride, size_t klpvl)
+// uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len, size_t val_len, size_t stride, size_t klpvl, gs_hash_bytes_func hash_func)
 
 #define gs_hash_table_exists(__HT, __HTK)\
         (__HT && _gs_hash_table_key_exists_internal((__HT), (__HTK)))
@@ -2102,7 +2323,7 @@ uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len
         {\
             /* Get idx for key */\
             (__HT)->tmp_key = (__HTK);\
-            uint32_t __IDX = gs_hash_table_get_key_index_func((void**)&(__HT)->data, (void*)&((__HT)->tmp_key), sizeof((__HT)->tmp_key), sizeof((__HT)->tmp_val), (__HT)->stride, (__HT)->klpvl);\
+            uint32_t __IDX = gs_hash_table_get_key_index_func((void**)&(__HT)->data, (void*)&((__HT)->tmp_key), sizeof((__HT)->tmp_key), sizeof((__HT)->tmp_val), (__HT)->stride, (__HT)->klpvl, (__HT)->hash_func);\
             if (__IDX != GS_HASH_TABLE_INVALID_INDEX) {\
                 (__HT)->data[__IDX].state = GS_HASH_TABLE_ENTRY_INACTIVE;\
                 if (gs_dyn_array_head((__HT)->data)->size) gs_dyn_array_head((__HT)->data)->size--;\
@@ -4668,6 +4889,203 @@ gs_atomic_cmp_swp(volatile uint32_t *dst, uint32_t swap, uint32_t cmp);
 GS_API_DECL int32_t 
 gs_atomic_add(volatile int32_t *dst, int32_t value);
 
+// Acquire load / release store
+GS_API_DECL uint32_t
+gs_atomic_load(volatile uint32_t* src);
+
+GS_API_DECL void
+gs_atomic_store(volatile uint32_t* dst, uint32_t value);
+
+/*================================================================================
+// Threads
+================================================================================*/
+
+#ifndef gs_thread_local
+    #if (defined __cplusplus)
+        #define gs_thread_local thread_local
+    #elif (defined _MSC_VER)
+        #define gs_thread_local __declspec(thread)
+    #elif (defined __GNUC__ || defined __clang__)
+        #define gs_thread_local __thread
+    #else
+        #define gs_thread_local _Thread_local
+    #endif
+#endif
+
+#ifndef GS_PLATFORM_WIN
+    #include <pthread.h>
+#endif
+
+typedef void (* gs_thread_func_t)(void* data);
+
+typedef struct gs_thread_t
+{
+#ifdef GS_PLATFORM_WIN
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    bool32_t valid;
+} gs_thread_t;
+
+typedef struct gs_mutex_t
+{
+#ifdef GS_PLATFORM_WIN
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif
+} gs_mutex_t;
+
+typedef struct gs_semaphore_t
+{
+#ifdef GS_PLATFORM_WIN
+    HANDLE handle;
+#else
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t count;
+#endif
+} gs_semaphore_t;
+
+// Returned thread is invalid (valid == false) if the platform could not spawn it
+GS_API_DECL gs_thread_t gs_thread_create(gs_thread_func_t func, void* data);
+GS_API_DECL void gs_thread_join(gs_thread_t* thread);
+
+GS_API_DECL void gs_mutex_init(gs_mutex_t* mutex);
+GS_API_DECL void gs_mutex_destroy(gs_mutex_t* mutex);
+GS_API_DECL void gs_mutex_lock(gs_mutex_t* mutex);
+GS_API_DECL void gs_mutex_unlock(gs_mutex_t* mutex);
+
+GS_API_DECL void gs_semaphore_init(gs_semaphore_t* sem, uint32_t count);
+GS_API_DECL void gs_semaphore_destroy(gs_semaphore_t* sem);
+GS_API_DECL void gs_semaphore_post(gs_semaphore_t* sem);
+GS_API_DECL void gs_semaphore_wait(gs_semaphore_t* sem);
+// Returns false on timeout
+GS_API_DECL bool gs_semaphore_wait_timeout(gs_semaphore_t* sem, uint32_t ms);
+
+// Apply to the calling thread. Names show up in debuggers/profilers (Linux truncates to 15 chars).
+GS_API_DECL void gs_thread_set_name(const char* name);
+GS_API_PRIVATE uint64_t _gs_os_time_ns();   // Monotonic OS clock in ns, unaffected by the headless virtual clock
+GS_API_DECL bool gs_thread_set_affinity(uint32_t core);     // Returns false where unsupported (Apple, web)
+
+/*================================================================================
+// Jobs
+================================================================================*/
+
+/*
+    Global worker pool on the bundled scheduler. The main thread counts as worker 0 and runs 
+    jobs while it waits, so a pool of N workers spawns N - 1 threads.
+
+    Jobs split [0, count) into ranges of at least `grain` elements (0 picks one from the 
+    worker count). gs_job_t is owned by the caller and must stay alive until the job is done. 
+    Jobs can be run and waited on from the main thread or from inside other jobs.
+
+    Usage: 
+
+        void scale(void* data, uint32_t start, uint32_t end, uint32_t worker) {
+            float* v = (float*)data;
+            for (uint32_t i = start; i < end; ++i) v[i] *= 2.f;
+        }
+
+        gs_parallel_for(values, scale, count, 1024);
+
+        gs_job_t a, b;
+        gs_jobs_run(&a, decode, assets, asset_count, 1);
+        gs_jobs_then(&a, &b, upload, assets, asset_count, 0);  // Runs once a completes
+        gs_jobs_wait(&b);
+*/
+
+#ifndef GS_JOBS_THREAD_NAME
+    #define GS_JOBS_THREAD_NAME "gs_worker"
+#endif
+
+typedef void (* gs_job_func_t)(void* data, uint32_t start, uint32_t end, uint32_t worker);
+
+typedef struct gs_jobs_desc_t
+{
+    uint32_t num_workers;   // Including the main thread (default one per core)
+    bool32_t pin_threads;   // Pin worker i to core i
+} gs_jobs_desc_t;
+
+typedef struct gs_job_t
+{
+    gs_sched_task_t task;
+    gs_job_func_t func;
+    void* data;
+    uint32_t count;
+    uint32_t grain;
+    volatile uint32_t remaining;    // Elements left to run, 0 once done
+    struct gs_job_t* volatile next; // Continuation
+} gs_job_t;
+
+GS_API_DECL void     gs_jobs_init(const gs_jobs_desc_t* desc);     // Optional, otherwise started on first use
+GS_API_DECL void     gs_jobs_shutdown();
+GS_API_DECL uint32_t gs_jobs_num_workers();
+GS_API_DECL void     gs_jobs_run(gs_job_t* job, gs_job_func_t func, void* data, uint32_t count, uint32_t grain);
+GS_API_DECL void     gs_jobs_then(gs_job_t* job, gs_job_t* next, gs_job_func_t func, void* data, uint32_t count, uint32_t grain);
+GS_API_DECL void     gs_jobs_wait(gs_job_t* job);                  // Runs other jobs while waiting
+GS_API_DECL bool32_t gs_jobs_done(const gs_job_t* job);
+GS_API_DECL void     gs_parallel_for(void* data, gs_job_func_t func, uint32_t count, uint32_t grain);
+
+/*================================================================================
+// Profile
+================================================================================*/
+
+/*
+    Hierarchical CPU profiler. Instrumentation compiles out unless GS_PROFILE is defined 
+    before including gs.h. Each thread records into its own buffer without locking, and 
+    captures are exported as Chrome trace JSON (chrome://tracing or ui.perfetto.dev).
+
+    Usage: 
+
+        gs_profile_scope("physics") {
+            step_world();
+        }
+
+        gs_profile_begin("decode");
+        decode_assets();
+        gs_profile_end();
+
+        gs_profile_write_chrome_trace("frame.json");
+        gs_profile_reset();     // Start a new capture
+
+    Names are stored by pointer and must outlive the capture (string literals). Leaving a 
+    gs_profile_scope block with return, break or goto skips its end, use begin/end there.
+*/
+
+#ifndef GS_PROFILE_MAX_EVENTS
+    #define GS_PROFILE_MAX_EVENTS   (1 << 16)   // Per thread and capture, further events are dropped
+#endif
+
+#ifndef GS_PROFILE_MAX_DEPTH
+    #define GS_PROFILE_MAX_DEPTH    64
+#endif
+
+#ifndef GS_PROFILE_MAX_THREADS
+    #define GS_PROFILE_MAX_THREADS  64          // Threads beyond this are not recorded
+#endif
+
+#ifdef GS_PROFILE
+    #define gs_profile_begin(NAME)  gs_profile_begin_impl(NAME)
+    #define gs_profile_end()        gs_profile_end_impl()
+    #define gs_profile_scope(NAME)\
+        for (int32_t gs_macro_cat(_gs_profile_, __LINE__) = (gs_profile_begin_impl(NAME), 0);\
+            !gs_macro_cat(_gs_profile_, __LINE__);\
+            gs_macro_cat(_gs_profile_, __LINE__) = (gs_profile_end_impl(), 1))
+#else
+    #define gs_profile_begin(NAME)
+    #define gs_profile_end()
+    #define gs_profile_scope(NAME)
+#endif
+
+GS_API_DECL void     gs_profile_begin_impl(const char* name);
+GS_API_DECL void     gs_profile_end_impl();
+GS_API_DECL void     gs_profile_set_thread_name(const char* name);     // Shown as the trace's thread name
+GS_API_DECL bool     gs_profile_write_chrome_trace(const char* path);   // Writes the current capture
+GS_API_DECL void     gs_profile_reset();
+GS_API_DECL uint32_t gs_profile_dropped();                              // Events dropped in the current capture
+
 /*================================================================================
 // Noise
 ================================================================================*/
@@ -4869,6 +5287,7 @@ typedef struct gs_token_t
 	const char* text;
 	gs_token_type type;
 	uint32_t len;
+    uint32_t line;        // Lexer line at this token (buffered mode)
 } gs_token_t;
 
 GS_API_DECL gs_token_t gs_token_invalid_token();
@@ -4896,6 +5315,8 @@ typedef struct gs_lexer_t
     size_t size;          // Optional
     size_t contents_size; // Optional
     uint32_t line;        // Line number
+    gs_token_t* tokens;   // Optional (buffered mode), see gs_lexer_buffer_tokens()
+    uint32_t token_idx;   // Cursor into buffered tokens
 } gs_lexer_t;
 
 GS_API_DECL void gs_lexer_set_contents(gs_lexer_t* lex, const char* contents);
@@ -4909,6 +5330,13 @@ GS_API_DECL gs_token_t gs_lexer_peek(gs_lexer_t* lex);
 GS_API_DECL bool gs_lexer_find_next_token_type(gs_lexer_t* lex, gs_token_type type);
 GS_API_DECL gs_token_t gs_lexer_advance_before_next_token_type(gs_lexer_t* lex, gs_token_type type);
 
+// Token-stream buffering: lexes all remaining contents up front, then serves tokens from an array.
+// Contents must not be modified while buffered. Free with gs_lexer_buffer_free().
+GS_API_DECL void gs_lexer_buffer_tokens(gs_lexer_t* lex);
+GS_API_DECL void gs_lexer_buffer_free(gs_lexer_t* lex);
+GS_API_DECL bool gs_lexer_buffered_can_lex(gs_lexer_t* lex);
+GS_API_DECL gs_token_t gs_lexer_buffered_next_token(gs_lexer_t* lex);
+
 // C specific functions for lexing
 GS_API_DECL gs_lexer_t gs_lexer_c_ctor(const char* contents);
 GS_API_DECL bool gs_lexer_c_can_lex(gs_lexer_t* lex);
@@ -4937,8 +5365,86 @@ typedef struct gs_platform_time_t
     float render;
     float delta;
     float frame;
+    float alpha;    // Interpolation factor between fixed updates [0, 1)
+
+    // Frame timing in ticks (see gs_platform_ticks()), the ms fields above are derived from these
+    uint64_t epoch;             // Monotonic clock at startup (ns)
+    uint64_t ticks;             // Ticks since startup at the start of the frame
+    uint64_t previous_ticks;
+    uint64_t update_ticks;
+    uint64_t render_ticks;
+    uint64_t frame_ticks;
 } gs_platform_time_t;
 
+// Time spun instead of slept before a frame deadline with hybrid pacing (ms)
+#ifndef GS_PLATFORM_FRAME_SPIN_MS
+    #define GS_PLATFORM_FRAME_SPIN_MS 1.5f
+#endif
+
+// Frames kept for frame time percentiles
+#ifndef GS_PLATFORM_FRAME_HISTORY
+    #define GS_PLATFORM_FRAME_HISTORY 256
+#endif
+
+// Fixed updates allowed per frame before the accumulator drops time
+#ifndef GS_PLATFORM_FIXED_MAX_STEPS
+    #define GS_PLATFORM_FIXED_MAX_STEPS 8
+#endif
+
+typedef enum gs_platform_frame_pacing
+{
+    GS_PLATFORM_FRAME_PACING_SLEEP = 0x00,  // Sleep for the remainder of the frame
+    GS_PLATFORM_FRAME_PACING_HYBRID,        // Sleep coarsely, then spin to the deadline
+    GS_PLATFORM_FRAME_PACING_NONE           // Don't limit frame rate
+} gs_platform_frame_pacing;
+
+typedef struct gs_platform_frame_stats_t
+{
+    float    p50;       // Frame time percentiles over the last GS_PLATFORM_FRAME_HISTORY frames (ms)
+    float    p95;
+    float    p99;
+    float    max;
+    uint32_t frames;    // Frames in history
+    uint64_t missed;    // Frames whose work finished past their deadline, since startup
+} gs_platform_frame_stats_t;
+
+typedef struct gs_platform_frame_pacer_t
+{
+    gs_platform_frame_pacing mode;
+    uint64_t deadline;                          // Next frame deadline (ns)
+    uint64_t last;                              // Previous frame release (ns)
+    float    history[GS_PLATFORM_FRAME_HISTORY];
+    uint32_t head;
+    uint32_t count;
+    uint64_t missed;
+    float    accumulator;                       // Fixed-timestep accumulator (s)
+} gs_platform_frame_pacer_t;
+
+// Frames still drawn after the last activity, so state that settles a frame later (hover, layout) is shown
+#ifndef GS_PLATFORM_IDLE_SETTLE_FRAMES
+    #define GS_PLATFORM_IDLE_SETTLE_FRAMES 2
+#endif
+
+typedef struct gs_platform_idle_stats_t
+{
+    uint64_t idle_frames;       // Frames that blocked before running
+    uint64_t wakes;             // Blocks ended by gs_platform_wake()
+    float    wait;              // Last block (ms)
+    float    wake_latency;      // Last gs_platform_wake() until the frame resumed (ms)
+    float    wake_latency_max;
+} gs_platform_idle_stats_t;
+
+typedef struct gs_platform_idle_t
+{
+    bool32_t enabled;
+    float    timeout;                   // Longest block (ms), <= 0 to wait indefinitely
+    uint32_t active;                    // Frames left before blocking
+    volatile uint32_t redraw;           // Set from any thread by request_redraw/wake
+    volatile uint32_t woken;
+    volatile uint64_t wake_time;        // gs_platform_elapsed_time_ns() of the last wake
+    gs_platform_idle_stats_t stats;
+} gs_platform_idle_t;
+
 /*============================================================
 // Platform UUID
 ============================================================*/
@@ -5404,9 +5910,68 @@ typedef struct gs_platform_event_t
         gs_platform_app_event_t     app;
         gs_platform_text_event_t    text;
     };
+    uint64_t time;  // Timestamp in ns (gs_platform_elapsed_time_ns()) when queued
     uint32_t idx;
 } gs_platform_event_t;
 
+// Capacity of the platform event queue, must be a power of two
+#ifndef GS_PLATFORM_EVENT_QUEUE_SIZE
+    #define GS_PLATFORM_EVENT_QUEUE_SIZE 1024
+#endif
+
+// Fixed-capacity FIFO of this frame's events. Indices are free-running and masked on access.
+typedef struct gs_platform_event_queue_t
+{
+    gs_platform_event_t* data;
+    uint32_t mask;
+    uint32_t head;      // Oldest event
+    uint32_t tail;      // One past newest event
+} gs_platform_event_queue_t;
+
+// Time allowed per frame for draining native window events (ms)
+#ifndef GS_PLATFORM_EVENT_BUDGET_MS
+    #define GS_PLATFORM_EVENT_BUDGET_MS 4.f
+#endif
+
+// Counters for the native event pump
+typedef struct gs_platform_event_stats_t
+{
+    uint32_t events;            // Native events drained this frame
+    uint32_t backlog;           // Events beyond the first per window this frame (frames of input lag avoided)
+    uint32_t windows;           // Windows pumped this frame
+    float    pump_time;         // Time spent draining this frame (ms)
+    bool32_t budget_exceeded;   // Budget ran out with events still pending this frame
+    uint32_t dropped;           // Events dropped this frame because the queue was full
+    uint32_t queue_high_water;  // Most events queued at once since startup
+    uint64_t total_events;      // Running totals since startup
+    uint64_t total_backlog;
+    uint64_t total_dropped;
+    uint32_t budget_exceeded_frames;
+    float    pump_time_max;
+} gs_platform_event_stats_t;
+
+// Input recording / replay
+typedef enum gs_platform_input_log_mode
+{
+    GS_PLATFORM_INPUT_LOG_NONE = 0x00,
+    GS_PLATFORM_INPUT_LOG_RECORD,
+    GS_PLATFORM_INPUT_LOG_REPLAY
+} gs_platform_input_log_mode;
+
+// Log layout: header, then per frame {elapsed, delta, frame, changed input words, events}.
+// Input is stored as the 32-bit words that differ from the previous frame.
+typedef struct gs_platform_input_log_t
+{
+    gs_platform_input_log_mode mode;
+    gs_byte_buffer_t buffer;
+    gs_platform_input_t prev;           // Input as of the last logged frame
+    char path[256];                     // Written on gs_platform_input_record_end()
+    uint32_t frame;
+    uint32_t frames;
+    bool32_t fast;                      // Replay without frame pacing
+    gs_platform_frame_pacing pacing;    // Restored after a fast replay
+} gs_platform_input_log_t;
+
 // Necessary function pointer typedefs
 typedef void (* gs_dropped_files_callback_t)(void*, int32_t count, const char** file_paths);
 typedef void (* gs_window_close_callback_t)(void*);
@@ -5426,6 +5991,8 @@ typedef struct gs_platform_t
 
     // Time
     gs_platform_time_t time;
+    gs_platform_frame_pacer_t pacer;
+    gs_platform_idle_t idle;
 
     // Input
     gs_platform_input_t input;
@@ -5433,8 +6000,25 @@ typedef struct gs_platform_t
     // Window data and handles
     gs_slot_array(gs_platform_window_t) windows;
 
-    // Events that user can poll
-    gs_dyn_array(gs_platform_event_t) events;
+    // Events that user can poll, oldest first
+    gs_platform_event_queue_t events;
+
+    // Native event pump budget (ms, <= 0 for unbounded) and counters
+    float event_budget;
+    gs_platform_event_stats_t event_stats;
+
+    // Events injected for the next frame
+    gs_dyn_array(gs_platform_event_t) injected;
+
+    // Headless mode: no native window, graphics context or audio device
+    struct {
+        bool32_t enabled;
+        bool32_t virtual_clock;
+        uint64_t time;      // Virtual clock (ns)
+    } headless;
+
+    // Input recording / replay
+    gs_platform_input_log_t input_log;
 
     // Cursors
     void* cursors[GS_PLATFORM_CURSOR_COUNT];
@@ -5462,8 +6046,48 @@ GS_API_DECL void gs_platform_update(gs_platform_t* platform);    // Update platf
 
 // Platform Util
 GS_API_DECL const gs_platform_time_t* gs_platform_time();
+
+// Ticks are a 64-bit monotonic count since startup, so precision doesn't degrade with uptime
+#define GS_PLATFORM_TICKS_PER_SECOND 1000000000ull
+
+GS_API_DECL uint64_t gs_platform_ticks();            // Ticks since startup
+GS_API_DECL uint64_t gs_platform_ticks_frequency();  // Ticks per second
+
+gs_force_inline double 
+gs_platform_ticks_to_sec(uint64_t ticks)
+{
+    return (double)ticks / (double)GS_PLATFORM_TICKS_PER_SECOND;
+}
+
+gs_force_inline double 
+gs_platform_ticks_to_ms(uint64_t ticks)
+{
+    return (double)ticks * 1000.0 / (double)GS_PLATFORM_TICKS_PER_SECOND;
+}
+
+gs_force_inline uint64_t 
+gs_platform_ms_to_ticks(double ms)
+{
+    return ms > 0.0 ? (uint64_t)(ms * (double)GS_PLATFORM_TICKS_PER_SECOND / 1000.0) : 0;
+}
 GS_API_DECL float  gs_platform_delta_time();
 GS_API_DECL float  gs_platform_frame_time();
+GS_API_DECL void   gs_platform_frame_pace();                                   // Waits for the next frame deadline, records frame time
+GS_API_DECL void   gs_platform_set_frame_pacing(gs_platform_frame_pacing mode);
+GS_API_DECL gs_platform_frame_stats_t gs_platform_frame_stats();
+
+/*
+    Idle mode: once a frame had no events, no redraw request and no live async tasks (and 
+    GS_PLATFORM_IDLE_SETTLE_FRAMES have passed), the next gs_frame() blocks on window events, 
+    gs_platform_wake() or the idle timeout instead of redrawing at max_fps. Time spent blocked 
+    is excluded from the frame delta. Disabled while recording/replaying input and with the 
+    headless virtual clock.
+*/
+GS_API_DECL void     gs_platform_set_idle(bool32_t enabled);
+GS_API_DECL void     gs_platform_set_idle_timeout(float ms);     // Longest block, e.g. for timers or a blinking caret (<= 0 for none)
+GS_API_DECL void     gs_platform_request_redraw();               // Draw the next frame, call every frame while animating
+GS_API_DECL void     gs_platform_wake();                         // Thread safe, unblocks an idle wait and requests a redraw
+GS_API_DECL gs_platform_idle_stats_t gs_platform_idle_stats();
 
 // Platform UUID
 GS_API_DECL gs_uuid_t gs_platform_uuid_generate();
@@ -5508,6 +6132,18 @@ GS_API_DECL void      gs_platform_touch_position(uint32_t idx, float* x, float*
 // Platform Events
 GS_API_DECL bool      gs_platform_poll_events(gs_platform_event_t* evt, bool32_t consume);
 GS_API_DECL void      gs_platform_add_event(gs_platform_event_t* evt);
+GS_API_DECL void      gs_platform_clear_events();
+GS_API_DECL void      gs_platform_inject_event(const gs_platform_event_t* evt);    // Processed with next frame's input, like a native event
+GS_API_DECL bool32_t  gs_platform_headless();
+
+// Input Recording / Replay (per-frame input, events and time; replay drives gs_frame() identically)
+GS_API_DECL gs_result gs_platform_input_record_begin(const char* path);
+GS_API_DECL gs_result gs_platform_input_record_end();                        // Writes the log
+GS_API_DECL gs_result gs_platform_input_replay_begin(const char* path, bool32_t fast);   // Fast skips frame pacing
+GS_API_DECL void      gs_platform_input_replay_end();                        // Called automatically after the last frame
+GS_API_DECL gs_platform_input_log_mode gs_platform_input_log_get_mode();
+GS_API_DECL const gs_platform_event_stats_t* gs_platform_event_stats();
+GS_API_DECL void      gs_platform_set_event_budget(float ms);   // Per-frame drain budget in ms, <= 0 for unbounded
 
 // Platform Window
 GS_API_DECL uint32_t gs_platform_window_create(const gs_platform_window_desc_t* desc);
@@ -5522,8 +6158,19 @@ typedef struct gs_platform_file_stats_s
     uint64_t access_time;
 } gs_platform_file_stats_t;
 
+// Read-only view of a file's contents, see gs_platform_file_map()
+typedef struct gs_platform_file_map_t
+{
+    const char* data;   // Always followed by a '\0', so text can be parsed in place (NULL on failure)
+    size_t size;        // Size of file in bytes
+    bool32_t heap;      // Data is a heap copy (platform without file mapping or page-aligned file size)
+    bool32_t archive;   // Data is a view into a mounted archive (see gs_platform_archive_mount())
+} gs_platform_file_map_t;
+
 // Platform File IO (this all needs to be made available for impl rewrites)
 GS_API_DECL char*      gs_platform_read_file_contents_default_impl(const char* file_path, const char* mode, size_t* sz);
+GS_API_DECL gs_platform_file_map_t gs_platform_file_map_default_impl(const char* file_path);
+GS_API_DECL void       gs_platform_file_unmap_default_impl(gs_platform_file_map_t* map);
 GS_API_DECL gs_result  gs_platform_write_file_contents_default_impl(const char* file_path, const char* mode, void* data, size_t data_size);
 GS_API_DECL bool       gs_platform_file_exists_default_impl(const char* file_path);
 GS_API_DECL bool       gs_platform_dir_exists_default_impl(const char* dir_path);
@@ -5542,6 +6189,12 @@ GS_API_DECL void*      gs_platform_library_proc_address_default_impl(void* lib,
 #ifndef gs_platform_read_file_contents
 #define gs_platform_read_file_contents gs_platform_read_file_contents_default_impl
 #endif
+#ifndef gs_platform_file_map
+#define gs_platform_file_map gs_platform_file_map_default_impl
+#endif
+#ifndef gs_platform_file_unmap
+#define gs_platform_file_unmap gs_platform_file_unmap_default_impl
+#endif
 #ifndef gs_platform_write_file_contents
 #define gs_platform_write_file_contents gs_platform_write_file_contents_default_impl
 #endif
@@ -5579,6 +6232,142 @@ GS_API_DECL void*      gs_platform_library_proc_address_default_impl(void* lib,
 #define gs_platform_library_proc_address gs_platform_library_proc_address_default_impl
 #endif
 
+/* == Platform Async File IO == */
+
+/*
+    Background file IO service. Requests are queued by priority and serviced by worker threads 
+    (started on first submit, count from gs_app_desc_t.io_workers). Completion callbacks are always 
+    invoked on the main thread from gs_platform_io_dispatch(), which gs_frame() calls right after 
+    gs_platform_update() and before the application update. If threads are unavailable, requests 
+    execute synchronously on submit but are still delivered through dispatch.
+*/
+
+#ifndef GS_PLATFORM_IO_DEFAULT_WORKERS
+    #define GS_PLATFORM_IO_DEFAULT_WORKERS 2
+#endif
+
+typedef enum gs_platform_io_op
+{
+    GS_PLATFORM_IO_OP_READ = 0x00,     // Read whole file
+    GS_PLATFORM_IO_OP_READ_RANGE,      // Read [offset, offset + size)
+    GS_PLATFORM_IO_OP_WRITE            // Write size bytes of data (data is copied on submit)
+} gs_platform_io_op;
+
+typedef enum gs_platform_io_priority
+{
+    GS_PLATFORM_IO_PRIORITY_LOW = 0x00,
+    GS_PLATFORM_IO_PRIORITY_NORMAL,
+    GS_PLATFORM_IO_PRIORITY_HIGH,
+    GS_PLATFORM_IO_PRIORITY_COUNT
+} gs_platform_io_priority;
+
+typedef enum gs_platform_io_status
+{
+    GS_PLATFORM_IO_STATUS_COMPLETE = 0x00,
+    GS_PLATFORM_IO_STATUS_FAILED,
+    GS_PLATFORM_IO_STATUS_CANCELLED
+} gs_platform_io_status;
+
+typedef struct gs_platform_io_result_t
+{
+    uint32_t id;
+    gs_platform_io_op op;
+    gs_platform_io_status status;
+    const char* path;
+    void* data;                 // Read data, '\0' terminated. Freed after the callback unless set to NULL (takes ownership)
+    size_t size;                // Bytes read or written
+    void* user_data;
+} gs_platform_io_result_t;
+
+typedef void (* gs_platform_io_callback_t)(gs_platform_io_result_t* result);
+
+typedef struct gs_platform_io_request_desc_t
+{
+    gs_platform_io_op op;
+    const char* path;           // Copied on submit
+    size_t offset;              // READ_RANGE
+    size_t size;                // READ_RANGE, WRITE
+    const void* data;           // WRITE
+    gs_platform_io_priority priority;
+    gs_platform_io_callback_t callback;
+    void* user_data;
+} gs_platform_io_request_desc_t;
+
+GS_API_DECL void     gs_platform_io_init(uint32_t worker_count);      // Optional, submit initializes on demand
+GS_API_DECL void     gs_platform_io_shutdown();                       // Pending requests are dropped without callbacks
+GS_API_DECL uint32_t gs_platform_io_submit(const gs_platform_io_request_desc_t* desc);   // Returns request id (0 on failure)
+GS_API_DECL bool     gs_platform_io_cancel(uint32_t id);              // Callback still fires, with GS_PLATFORM_IO_STATUS_CANCELLED
+GS_API_DECL uint32_t gs_platform_io_dispatch();                       // Invokes completion callbacks, returns count
+GS_API_DECL uint32_t gs_platform_io_pending();                        // Requests submitted but not yet dispatched
+
+/* == Platform Archives == */
+
+/*
+    Packed archive: header, entry data (each aligned to GS_PLATFORM_ARCHIVE_ALIGN and followed by a '\0'), 
+    path string table, then an index sorted by path hash. Mounted archives are memory-mapped and searched, 
+    most recently mounted first, by the default read_file_contents, file_map, file_exists and 
+    file_size_in_bytes impls before the filesystem, so every *_load_from_file reads from them transparently. 
+    Uncompressed entries are mapped in place, compressed ones are decompressed on read. 
+    Mount/unmount on the main thread while no async IO is in flight.
+*/
+
+#ifndef GS_PLATFORM_ARCHIVE_ALIGN
+    #define GS_PLATFORM_ARCHIVE_ALIGN 64
+#endif
+
+typedef struct gs_platform_archive_entry_desc_t
+{
+    const char* path;       // Virtual path, as requested by loaders
+    const char* src_path;   // File on disk to pack (defaults to path)
+} gs_platform_archive_entry_desc_t;
+
+typedef struct gs_platform_archive_pack_desc_t
+{
+    const gs_platform_archive_entry_desc_t* entries;
+    size_t size;            // Size of entries array in bytes
+    bool32_t compress;      // LZ compress entries that shrink by at least 1/8
+} gs_platform_archive_pack_desc_t;
+
+GS_API_DECL bool     gs_platform_archive_pack(const char* out_path, const gs_platform_archive_pack_desc_t* desc);
+GS_API_DECL bool     gs_platform_archive_pack_dir(const char* out_path, const char* dir_path, bool32_t compress);  // Recursive, virtual paths are "dir_path/..."
+GS_API_DECL uint32_t gs_platform_archive_mount(const char* archive_path);   // Returns handle, 0 on failure
+GS_API_DECL void     gs_platform_archive_unmount(uint32_t hndl);
+GS_API_DECL bool     gs_platform_archive_contains(const char* path);
+GS_API_DECL int32_t  gs_platform_archive_file_size(const char* path);       // -1 if not in any mounted archive
+GS_API_DECL char*    gs_platform_archive_read(const char* path, size_t* sz); // Heap copy, '\0' terminated, NULL if not in any mounted archive
+GS_API_DECL bool     gs_platform_archive_map(const char* path, gs_platform_file_map_t* map);
+
+/* == Platform File Watch == */
+
+/*
+    Watches individual files for changes. Backed by inotify on Linux (watching the parent directory, so 
+    editors that save by rename are still seen), elsewhere by polling file stats every 
+    GS_PLATFORM_FILE_WATCH_POLL_MS. Changes are coalesced per file until it has been quiet for 
+    GS_PLATFORM_FILE_WATCH_DEBOUNCE_MS, then delivered once from gs_platform_file_watch_update(), which 
+    gs_frame() calls every frame. Callbacks may watch/unwatch.
+*/
+
+#ifndef GS_PLATFORM_FILE_WATCH_DEBOUNCE_MS
+    #define GS_PLATFORM_FILE_WATCH_DEBOUNCE_MS 100
+#endif
+
+#ifndef GS_PLATFORM_FILE_WATCH_POLL_MS
+    #define GS_PLATFORM_FILE_WATCH_POLL_MS 500
+#endif
+
+typedef enum gs_platform_file_watch_event
+{
+    GS_PLATFORM_FILE_WATCH_MODIFIED = 0x00,     // Written, created or replaced
+    GS_PLATFORM_FILE_WATCH_DELETED
+} gs_platform_file_watch_event;
+
+typedef void (* gs_platform_file_watch_cb_t)(const char* path, gs_platform_file_watch_event evt, void* user_data);
+
+GS_API_DECL uint32_t gs_platform_file_watch(const char* path, gs_platform_file_watch_cb_t cb, void* user_data);  // Returns handle, 0 on failure
+GS_API_DECL void     gs_platform_file_unwatch(uint32_t hndl);
+GS_API_DECL uint32_t gs_platform_file_watch_update();   // Delivers debounced changes, returns count
+GS_API_DECL void     gs_platform_file_watch_shutdown();
+
 /* == Platform Dependent API == */
 
 GS_API_DECL void            gs_platform_init(gs_platform_t* platform);      // Initialize platform layer
@@ -5588,7 +6377,10 @@ GS_API_DECL void gs_platform_update_internal(gs_platform_t* platform);
 
 // Platform Util
 GS_API_DECL double gs_platform_elapsed_time();  // Returns time in ms since initialization of platform
+GS_API_DECL uint64_t gs_platform_elapsed_time_ns(); // Returns monotonic high-resolution time in ns
 GS_API_DECL void   gs_platform_sleep(float ms); // Sleeps platform for time in ms
+GS_API_DECL void   gs_platform_wait_events(float timeout);     // Blocks until a native event, wake or timeout in ms (<= 0 for none)
+GS_API_DECL void   gs_platform_wake_internal();                // Unblocks gs_platform_wait_events() from any thread
 
 // Platform Video
 GS_API_DECL void gs_platform_enable_vsync(int32_t enabled);
@@ -5638,19 +6430,69 @@ typedef struct gs_platform_interface_s
 
 /** @} */ // end of gs_platform
 
-/*=============================
-// GS_AUDIO
-=============================*/
+/*================================================================================
+// Async
+================================================================================*/
 
-/** @defgroup gs_audio Audio
- *  Gunslinger Audio
- *  @{
- */
+/*
+    Coroutine tasks on top of gs_coro (minicoro) and gs_jobs. A task body is plain sequential code 
+    that suspends with the gs_async_await_* calls. Tasks start and resume from gs_async_update(), 
+    which gs_frame() calls after IO completions are dispatched and before the application update.
 
-typedef enum gs_audio_file_type
-{
-    GS_OGG = 0x00,
-    GS_WAV,
+    Tasks resume on the main thread unless they await a worker, after which they continue inside 
+    a job until their next await. The await calls are only valid inside a task.
+
+    Usage: 
+
+        void load_level(void* user_data) {
+            gs_platform_io_result_t res = gs_default_val();
+            gs_platform_io_request_desc_t req = gs_default_val();
+            req.path = "assets/level.bin";
+            if (!gs_async_await_io(&req, &res)) return;
+
+            gs_async_await_worker();            // Parse off the main thread
+            level_t* level = level_parse(res.data, res.size);
+            gs_free(res.data);
+
+            gs_async_await_frames(1);           // Back on main, next frame
+            level_upload(level);
+        }
+
+        uint32_t task = gs_async_run(load_level, NULL);
+*/
+
+#ifndef GS_ASYNC_STACK_SIZE
+    #define GS_ASYNC_STACK_SIZE 0   // 0 uses MCO_DEFAULT_STACK_SIZE
+#endif
+
+typedef void (* gs_async_func_t)(void* user_data);
+
+GS_API_DECL uint32_t gs_async_run(gs_async_func_t func, void* user_data);   // Returns task id (0 on failure), starts on next update
+GS_API_DECL bool32_t gs_async_done(uint32_t task);
+GS_API_DECL uint32_t gs_async_update();                                     // Resumes ready tasks, returns number still alive
+GS_API_DECL void     gs_async_shutdown();                                   // Destroys suspended tasks without resuming them
+
+// Inside a task
+GS_API_DECL void     gs_async_await_frames(uint32_t n);
+GS_API_DECL void     gs_async_await_job(gs_job_t* job);
+GS_API_DECL void     gs_async_await_task(uint32_t task);
+GS_API_DECL bool32_t gs_async_await_io(const gs_platform_io_request_desc_t* desc, gs_platform_io_result_t* out);  // Takes ownership of out->data, out->path is NULL
+GS_API_DECL void     gs_async_await_worker();                               // Continue on a job worker
+GS_API_DECL void     gs_async_await_main();                                 // Continue on the main thread
+
+/*=============================
+// GS_AUDIO
+=============================*/
+
+/** @defgroup gs_audio Audio
+ *  Gunslinger Audio
+ *  @{
+ */
+
+typedef enum gs_audio_file_type
+{
+    GS_OGG = 0x00,
+    GS_WAV,
     GS_MP3  
 } gs_audio_file_type;
 
@@ -6394,6 +7236,35 @@ typedef struct gs_graphics_draw_desc_t
     } range;
 } gs_graphics_draw_desc_t;
 
+/* Graphics Draw Indirect Commands */
+// Layouts read by the GPU from an indirect buffer, one per draw
+typedef struct gs_graphics_draw_indirect_command_t
+{
+    uint32_t count;
+    uint32_t instances;
+    uint32_t first;                             // First vertex
+    uint32_t base_instance;
+} gs_graphics_draw_indirect_command_t;
+
+typedef struct gs_graphics_draw_indexed_indirect_command_t
+{
+    uint32_t count;
+    uint32_t instances;
+    uint32_t first;                             // First index, relative to the start of the bound index buffer
+    int32_t base_vertex;
+    uint32_t base_instance;
+} gs_graphics_draw_indexed_indirect_command_t;
+
+/* Graphics Draw Indirect Desc */
+// Draws are indexed when an index buffer is bound, using gs_graphics_draw_indexed_indirect_command_t
+typedef struct gs_graphics_draw_indirect_desc_t
+{
+    gs_handle(gs_graphics_storage_buffer_t) buffer; // Storage buffer holding the commands (filled by the cpu or a compute pass)
+    size_t offset;                                  // Byte offset of the first command
+    uint32_t draw_count;                            // Number of commands to draw (multi draw only)
+    uint32_t stride;                                // Bytes between commands, 0 for tightly packed
+} gs_graphics_draw_indirect_desc_t;
+
 gs_inline gs_handle(gs_graphics_renderpass_t)
 __gs_renderpass_default_impl() 
 {
@@ -6544,11 +7415,42 @@ GS_API_DECL void gs_graphics_clear(gs_command_buffer_t* cb, gs_graphics_clear_de
 GS_API_DECL void gs_graphics_pipeline_bind(gs_command_buffer_t* cb, gs_handle(gs_graphics_pipeline_t) hndl);
 GS_API_DECL void gs_graphics_apply_bindings(gs_command_buffer_t* cb, gs_graphics_bind_desc_t* binds);
 GS_API_DECL void gs_graphics_draw(gs_command_buffer_t* cb, gs_graphics_draw_desc_t* desc);
+GS_API_DECL void gs_graphics_draw_indirect(gs_command_buffer_t* cb, gs_graphics_draw_indirect_desc_t* desc);
+GS_API_DECL void gs_graphics_multi_draw_indirect(gs_command_buffer_t* cb, gs_graphics_draw_indirect_desc_t* desc);
 GS_API_DECL void gs_graphics_dispatch_compute(gs_command_buffer_t* cb, uint32_t num_x_groups, uint32_t num_y_groups, uint32_t num_z_groups);
 
 // Submission (Main Thread)
 #define gs_graphics_command_buffer_submit(CB)  gs_graphics()->api.command_buffer_submit((CB))
 
+// Render Thread (opt-in, gs_app_desc_t.render_thread)
+// The main thread records frame N+1 while the render thread, which owns the context, executes frame N.
+// While active, calls through gs_graphics()->api run on the render thread and block until complete.
+typedef struct gs_graphics_render_thread_stats_t
+{
+    float wait;         // ms the main thread blocked on the previous frame at present
+    float render;       // ms the render thread spent executing and swapping the last frame
+    uint32_t calls;     // Resource calls marshalled during the last frame
+} gs_graphics_render_thread_stats_t;
+
+GS_API_DECL bool gs_graphics_render_thread_start(uint32_t window);      // Hands window's context to a new render thread
+GS_API_DECL void gs_graphics_render_thread_stop();                      // Drains the last frame, context returns to the caller
+GS_API_DECL bool gs_graphics_render_thread_active();
+GS_API_DECL void gs_graphics_render_thread_present();                   // Queues the recorded frame, replaces the window swap
+GS_API_DECL void gs_graphics_render_thread_exec(void (* func)(void* user_data), void* user_data);  // Runs func where the context is current
+GS_API_DECL gs_graphics_render_thread_stats_t gs_graphics_render_thread_stats();
+
+// Redundant state filtering: the backend shadows fixed function state, viewport/scissor and the 
+// bound program, and only emits calls that change them. Invalidate after changing state with 
+// raw API calls outside of command buffers.
+typedef struct gs_graphics_state_stats_t
+{
+    uint64_t emitted;   // State calls sent to the driver
+    uint64_t skipped;   // State calls filtered as redundant
+} gs_graphics_state_stats_t;
+
+GS_API_DECL gs_graphics_state_stats_t gs_graphics_state_stats();
+GS_API_DECL void gs_graphics_state_invalidate();
+
 #ifndef GS_NO_SHORT_NAME
     
 typedef gs_handle(gs_graphics_shader_t)         gs_shader_t;
@@ -6582,6 +7484,7 @@ typedef struct gs_asset_texture_t
 } gs_asset_texture_t;
 
 GS_API_DECL bool gs_asset_texture_load_from_file(const char* path, void* out, gs_graphics_texture_desc_t* desc, bool32_t flip_on_load, bool32_t keep_data);
+GS_API_DECL bool gs_asset_texture_reload(const char* path, void* out);   // Re-uploads file contents into existing texture, keeping its desc
 GS_API_DECL bool gs_asset_texture_load_from_memory(const void* memory, size_t sz, void* out, gs_graphics_texture_desc_t* desc, bool32_t flip_on_load, bool32_t keep_data);
 
 // Font
@@ -6715,6 +7618,17 @@ typedef struct gs_app_desc_t
     gs_platform_window_desc_t window;
     bool32 is_running;
     bool32 debug_gfx;
+    uint32_t io_workers;    // Async file IO worker threads (default GS_PLATFORM_IO_DEFAULT_WORKERS)
+    gs_jobs_desc_t jobs;    // Job worker pool, started on first use
+    gs_platform_frame_pacing frame_pacing;
+    void (* fixed_update)();    // Optional, called every fixed_timestep before update
+    float fixed_timestep;       // Seconds
+    struct {
+        bool32 enabled;         // No window, graphics context or audio device; window size is the synthetic framebuffer
+        bool32 virtual_clock;   // Time advances exactly one frame period per frame, without waiting
+    } headless;
+    bool32 render_thread;       // Execute command buffers on a dedicated thread, one frame behind
+    bool32 idle;                // Block on events when nothing changed, see gs_platform_set_idle()
     void* user_data;
 
     // Platform specific data
@@ -6727,6 +7641,19 @@ typedef struct gs_app_desc_t
 
 } gs_app_desc_t;
 
+// Startup timing breakdown in ms, reported once after the first frame
+typedef struct gs_startup_stats_t
+{
+    float platform;         // Native platform init
+    float window;           // Main window, graphics context and GL loader
+    float graphics;
+    float audio;            // Main thread part, the device is opened in the background
+    float audio_device;     // Background device probe and start, 0 until it completes
+    float app_init;         // gs_app_desc_t.init
+    float first_frame;      // gs_create until the end of the first frame
+    uint64_t begin;         // OS clock (ns) at gs_create
+} gs_startup_stats_t;
+
 /*
     Game Context: 
 
@@ -6742,6 +7669,7 @@ typedef struct gs_context_t
     gs_app_desc_t app; 
     gs_os_api_t os;
     gs_atomic_int_t lock;
+    gs_startup_stats_t startup;
 } gs_context_t;
 
 typedef struct gs_t
@@ -6786,6 +7714,10 @@ gs_quit();
 GS_API_DECL gs_app_desc_t 
 gs_main(int32_t argc, char** argv);
 
+/* Desc */
+GS_API_DECL const gs_startup_stats_t* 
+gs_startup_stats();
+
 #define gs_subsystem(__T)\
     (gs_instance()->ctx.__T)
 
@@ -7033,6 +7965,428 @@ gs_graphics_storage_buffer_get_data(gs_handle(gs_graphics_storage_buffer_t) hndl
     return gs_graphics()->api.storage_buffer_get_data(hndl, offset, sz, out);
 }
 
+/*=============================
+// Render Thread
+=============================*/
+
+typedef struct _gs_render_frame_t
+{
+    gs_byte_buffer_t commands;      // Per submit: [u32 num_commands][u32 size][u64 pad][size bytes, padded to 16]
+    gs_dyn_array(uint32_t) windows; // Swapped after execution
+} _gs_render_frame_t;
+
+typedef struct _gs_render_thread_t
+{
+    gs_graphics_t backend;          // Original api, only called where the context is current
+    gs_thread_t thread;
+    gs_mutex_t lock;                // Serializes marshalled calls
+    gs_semaphore_t wake;            // One post per queued frame or call
+    gs_semaphore_t call_done;
+    gs_semaphore_t frame_done;
+    void (* volatile call)(void* user_data);
+    void* volatile call_data;
+    _gs_render_frame_t frames[2];
+    _gs_render_frame_t* volatile pending;
+    uint32_t record;                // Frame the main thread records into
+    volatile bool32_t quit;
+    void* window;                   // Raw handle of the window whose context the thread owns
+    uint32_t calls;
+    gs_graphics_render_thread_stats_t stats;
+    bool32_t active;
+} _gs_render_thread_t;
+
+gs_global _gs_render_thread_t _gs_render_thread = gs_default_val();
+gs_global gs_thread_local bool32_t _gs_render_thread_self = false;
+
+GS_API_PRIVATE void
+_gs_render_thread_execute(_gs_render_frame_t* frame)
+{
+    gs_byte_buffer_t* buf = &frame->commands;
+    uint32_t pos = 0;
+    while (pos < buf->size)
+    {
+        // Submit each recorded buffer in place, the backend only reads and resets it
+        gs_command_buffer_t cb = gs_default_val();
+        cb.num_commands = *(uint32_t*)(buf->data + pos);
+        cb.commands.size = *(uint32_t*)(buf->data + pos + sizeof(uint32_t));
+        cb.commands.capacity = cb.commands.size;
+        cb.commands.data = buf->data + pos + 16;
+        pos += 16 + ((cb.commands.size + 15) & ~15u);
+        _gs_render_thread.backend.api.command_buffer_submit(&cb);
+    }
+
+    for (uint32_t i = 0; i < gs_dyn_array_size(frame->windows); ++i) {
+        gs_platform_window_swap_buffer(frame->windows[i]);
+    }
+}
+
+GS_API_PRIVATE void
+_gs_render_thread_main(void* data)
+{
+    _gs_render_thread_t* rt = &_gs_render_thread;
+    _gs_render_thread_self = true;
+    gs_thread_set_name("gs_render");
+    if (rt->window) gs_platform_window_make_current_raw(rt->window);
+    gs_semaphore_post(&rt->call_done);
+
+    for (;;)
+    {
+        gs_semaphore_wait(&rt->wake);
+
+        // A queued frame goes before any call made after it was presented
+        if (rt->pending)
+        {
+            uint64_t start = gs_platform_elapsed_time_ns();
+            _gs_render_thread_execute(rt->pending);
+            rt->stats.render = (float)(gs_platform_elapsed_time_ns() - start) / 1000000.f;
+            rt->pending = NULL;
+            gs_semaphore_post(&rt->frame_done);
+        }
+        else if (rt->call)
+        {
+            rt->call(rt->call_data);
+            rt->call = NULL;
+            gs_semaphore_post(&rt->call_done);
+        }
+        else if (rt->quit)
+        {
+            break;
+        }
+    }
+
+    if (rt->window) gs_platform_window_make_current_raw(NULL);
+}
+
+GS_API_DECL void
+gs_graphics_render_thread_exec(void (* func)(void* user_data), void* user_data)
+{
+    _gs_render_thread_t* rt = &_gs_render_thread;
+    if (!rt->active || _gs_render_thread_self) {
+        func(user_data);
+        return;
+    }
+
+    gs_mutex_lock(&rt->lock);
+    rt->call_data = user_data;
+    rt->call = func;
+    rt->calls++;
+    gs_semaphore_post(&rt->wake);
+    gs_semaphore_wait(&rt->call_done);
+    gs_mutex_unlock(&rt->lock);
+}
+
+// Marshalled api, arguments travel by pointer since the caller blocks until the call completes
+typedef struct _gs_render_call_t
+{
+    const void* desc;
+    void* out;
+    uint32_t hndl;
+    size_t offset;
+    size_t size;
+    void* ret;
+} _gs_render_call_t;
+
+#define _GS_RENDER_THREAD_CREATE(NAME)\
+    GS_API_PRIVATE void _gs_render_thread_##NAME##_create_call(void* user_data)\
+    {\
+        _gs_render_call_t* c = (_gs_render_call_t*)user_data;\
+        c->hndl = _gs_render_thread.backend.api.NAME##_create((const gs_graphics_##NAME##_desc_t*)c->desc).id;\
+    }\
+    GS_API_PRIVATE gs_handle(gs_graphics_##NAME##_t) _gs_render_thread_##NAME##_create(const gs_graphics_##NAME##_desc_t* desc)\
+    {\
+        _gs_render_call_t c = gs_default_val();\
+        c.desc = desc;\
+        gs_graphics_render_thread_exec(_gs_render_thread_##NAME##_create_call, &c);\
+        return gs_handle_create(gs_graphics_##NAME##_t, c.hndl);\
+    }
+
+#define _GS_RENDER_THREAD_DESTROY(NAME)\
+    GS_API_PRIVATE void _gs_render_thread_##NAME##_destroy_call(void* user_data)\
+    {\
+        _gs_render_call_t* c = (_gs_render_call_t*)user_data;\
+        _gs_render_thread.backend.api.NAME##_destroy(gs_handle_create(gs_graphics_##NAME##_t, c->hndl));\
+    }\
+    GS_API_PRIVATE void _gs_render_thread_##NAME##_destroy(gs_handle(gs_graphics_##NAME##_t) hndl)\
+    {\
+        _gs_render_call_t c = gs_default_val();\
+        c.hndl = hndl.id;\
+        gs_graphics_render_thread_exec(_gs_render_thread_##NAME##_destroy_call, &c);\
+    }
+
+#define _GS_RENDER_THREAD_UPDATE(FUNC, NAME)\
+    GS_API_PRIVATE void _gs_render_thread_##FUNC##_call(void* user_data)\
+    {\
+        _gs_render_call_t* c = (_gs_render_call_t*)user_data;\
+        _gs_render_thread.backend.api.FUNC(gs_handle_create(gs_graphics_##NAME##_t, c->hndl), (gs_graphics_##NAME##_desc_t*)c->out);\
+    }\
+    GS_API_PRIVATE void _gs_render_thread_##FUNC(gs_handle(gs_graphics_##NAME##_t) hndl, gs_graphics_##NAME##_desc_t* desc)\
+    {\
+        _gs_render_call_t c = gs_default_val();\
+        c.hndl = hndl.id;\
+        c.out = desc;\
+        gs_graphics_render_thread_exec(_gs_render_thread_##FUNC##_call, &c);\
+    }
+
+_GS_RENDER_THREAD_CREATE(texture)
+_GS_RENDER_THREAD_CREATE(uniform)
+_GS_RENDER_THREAD_CREATE(shader)
+_GS_RENDER_THREAD_CREATE(vertex_buffer)
+_GS_RENDER_THREAD_CREATE(index_buffer)
+_GS_RENDER_THREAD_CREATE(uniform_buffer)
+_GS_RENDER_THREAD_CREATE(storage_buffer)
+_GS_RENDER_THREAD_CREATE(framebuffer)
+_GS_RENDER_THREAD_CREATE(renderpass)
+_GS_RENDER_THREAD_CREATE(pipeline)
+
+_GS_RENDER_THREAD_DESTROY(texture)
+_GS_RENDER_THREAD_DESTROY(uniform)
+_GS_RENDER_THREAD_DESTROY(shader)
+_GS_RENDER_THREAD_DESTROY(vertex_buffer)
+_GS_RENDER_THREAD_DESTROY(index_buffer)
+_GS_RENDER_THREAD_DESTROY(uniform_buffer)
+_GS_RENDER_THREAD_DESTROY(storage_buffer)
+_GS_RENDER_THREAD_DESTROY(framebuffer)
+_GS_RENDER_THREAD_DESTROY(renderpass)
+_GS_RENDER_THREAD_DESTROY(pipeline)
+
+_GS_RENDER_THREAD_UPDATE(vertex_buffer_update, vertex_buffer)
+_GS_RENDER_THREAD_UPDATE(index_buffer_update, index_buffer)
+_GS_RENDER_THREAD_UPDATE(storage_buffer_update, storage_buffer)
+_GS_RENDER_THREAD_UPDATE(texture_update, texture)
+_GS_RENDER_THREAD_UPDATE(texture_read, texture)
+
+GS_API_PRIVATE void
+_gs_render_thread_storage_buffer_map_get_call(void* user_data)
+{
+    _gs_render_call_t* c = (_gs_render_call_t*)user_data;
+    c->ret = _gs_render_thread.backend.api.storage_buffer_map_get(gs_handle_create(gs_graphics_storage_buffer_t, c->hndl));
+}
+
+GS_API_PRIVATE void*
+_gs_render_thread_storage_buffer_map_get(gs_handle(gs_graphics_storage_buffer_t) hndl)
+{
+    _gs_render_call_t c = gs_default_val();
+    c.hndl = hndl.id;
+    gs_graphics_render_thread_exec(_gs_render_thread_storage_buffer_map_get_call, &c);
+    return c.ret;
+}
+
+GS_API_PRIVATE void
+_gs_render_thread_storage_buffer_lock_call(void* user_data)
+{
+    _gs_render_call_t* c = (_gs_render_call_t*)user_data;
+    c->ret = _gs_render_thread.backend.api.storage_buffer_lock(gs_handle_create(gs_graphics_storage_buffer_t, c->hndl), c->offset, c->size);
+}
+
+GS_API_PRIVATE void*
+_gs_render_thread_storage_buffer_lock(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t sz)
+{
+    _gs_render_call_t c = gs_default_val();
+    c.hndl = hndl.id;
+    c.offset = offset;
+    c.size = sz;
+    gs_graphics_render_thread_exec(_gs_render_thread_storage_buffer_lock_call, &c);
+    return c.ret;
+}
+
+GS_API_PRIVATE void
+_gs_render_thread_storage_buffer_unlock_call(void* user_data)
+{
+    _gs_render_call_t* c = (_gs_render_call_t*)user_data;
+    _gs_render_thread.backend.api.storage_buffer_unlock(gs_handle_create(gs_graphics_storage_buffer_t, c->hndl));
+}
+
+GS_API_PRIVATE void
+_gs_render_thread_storage_buffer_unlock(gs_handle(gs_graphics_storage_buffer_t) hndl)
+{
+    _gs_render_call_t c = gs_default_val();
+    c.hndl = hndl.id;
+    gs_graphics_render_thread_exec(_gs_render_thread_storage_buffer_unlock_call, &c);
+}
+
+GS_API_PRIVATE void
+_gs_render_thread_storage_buffer_get_data_call(void* user_data)
+{
+    _gs_render_call_t* c = (_gs_render_call_t*)user_data;
+    _gs_render_thread.backend.api.storage_buffer_get_data(gs_handle_create(gs_graphics_storage_buffer_t, c->hndl), c->offset, c->size, c->out);
+}
+
+GS_API_PRIVATE void
+_gs_render_thread_storage_buffer_get_data(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t stride, void* out)
+{
+    _gs_render_call_t c = gs_default_val();
+    c.hndl = hndl.id;
+    c.offset = offset;
+    c.size = stride;
+    c.out = out;
+    gs_graphics_render_thread_exec(_gs_render_thread_storage_buffer_get_data_call, &c);
+}
+
+// Copies the buffer into the frame being recorded and resets it for reuse
+GS_API_PRIVATE void
+_gs_render_thread_command_buffer_submit(gs_command_buffer_t* cb)
+{
+    gs_global uint8_t zero[16] = gs_default_val();
+    _gs_render_thread_t* rt = &_gs_render_thread;
+    if (_gs_render_thread_self) {
+        rt->backend.api.command_buffer_submit(cb);
+        return;
+    }
+
+    gs_byte_buffer_t* buf = &rt->frames[rt->record].commands;
+    uint32_t sz = cb->commands.size;
+    gs_byte_buffer_write(buf, uint32_t, cb->num_commands);
+    gs_byte_buffer_write(buf, uint32_t, sz);
+    gs_byte_buffer_write(buf, uint64_t, 0);
+    gs_byte_buffer_write_bulk(buf, cb->commands.data, sz);
+    gs_byte_buffer_write_bulk(buf, zero, ((sz + 15) & ~15u) - sz);
+    gs_command_buffer_clear(cb);
+}
+
+GS_API_DECL bool
+gs_graphics_render_thread_start(uint32_t window)
+{
+    _gs_render_thread_t* rt = &_gs_render_thread;
+    gs_graphics_t* gfx = gs_graphics();
+    if (rt->active) return true;
+    if (!gfx) return false;
+
+    memset(rt, 0, sizeof(_gs_render_thread_t));
+    rt->backend = *gfx;
+    rt->window = gs_platform_raw_window_handle(window);   // NULL when headless
+    gs_mutex_init(&rt->lock);
+    gs_semaphore_init(&rt->wake, 0);
+    gs_semaphore_init(&rt->call_done, 0);
+    gs_semaphore_init(&rt->frame_done, 1);
+    for (uint32_t i = 0; i < 2; ++i) {
+        rt->frames[i].commands = gs_byte_buffer_new();
+    }
+
+    // A context can only be current on one thread
+    if (rt->window) gs_platform_window_make_current_raw(NULL);
+    rt->thread = gs_thread_create(_gs_render_thread_main, NULL);
+    if (!rt->thread.valid)
+    {
+        gs_log_warning("gs_graphics_render_thread_start: failed to create thread, rendering on the main thread");
+        if (rt->window) gs_platform_window_make_current_raw(rt->window);
+        for (uint32_t i = 0; i < 2; ++i) {
+            gs_byte_buffer_free(&rt->frames[i].commands);
+        }
+        gs_semaphore_destroy(&rt->frame_done);
+        gs_semaphore_destroy(&rt->call_done);
+        gs_semaphore_destroy(&rt->wake);
+        gs_mutex_destroy(&rt->lock);
+        return false;
+    }
+
+    // Wait for the context to be current on the render thread
+    gs_semaphore_wait(&rt->call_done);
+
+    gfx->api.texture_create = _gs_render_thread_texture_create;
+    gfx->api.uniform_create = _gs_render_thread_uniform_create;
+    gfx->api.shader_create = _gs_render_thread_shader_create;
+    gfx->api.vertex_buffer_create = _gs_render_thread_vertex_buffer_create;
+    gfx->api.index_buffer_create = _gs_render_thread_index_buffer_create;
+    gfx->api.uniform_buffer_create = _gs_render_thread_uniform_buffer_create;
+    gfx->api.storage_buffer_create = _gs_render_thread_storage_buffer_create;
+    gfx->api.framebuffer_create = _gs_render_thread_framebuffer_create;
+    gfx->api.renderpass_create = _gs_render_thread_renderpass_create;
+    gfx->api.pipeline_create = _gs_render_thread_pipeline_create;
+    gfx->api.texture_destroy = _gs_render_thread_texture_destroy;
+    gfx->api.uniform_destroy = _gs_render_thread_uniform_destroy;
+    gfx->api.shader_destroy = _gs_render_thread_shader_destroy;
+    gfx->api.vertex_buffer_destroy = _gs_render_thread_vertex_buffer_destroy;
+    gfx->api.index_buffer_destroy = _gs_render_thread_index_buffer_destroy;
+    gfx->api.uniform_buffer_destroy = _gs_render_thread_uniform_buffer_destroy;
+    gfx->api.storage_buffer_destroy = _gs_render_thread_storage_buffer_destroy;
+    gfx->api.framebuffer_destroy = _gs_render_thread_framebuffer_destroy;
+    gfx->api.renderpass_destroy = _gs_render_thread_renderpass_destroy;
+    gfx->api.pipeline_destroy = _gs_render_thread_pipeline_destroy;
+    gfx->api.vertex_buffer_update = _gs_render_thread_vertex_buffer_update;
+    gfx->api.index_buffer_update = _gs_render_thread_index_buffer_update;
+    gfx->api.storage_buffer_update = _gs_render_thread_storage_buffer_update;
+    gfx->api.texture_update = _gs_render_thread_texture_update;
+    gfx->api.texture_read = _gs_render_thread_texture_read;
+    gfx->api.storage_buffer_map_get = _gs_render_thread_storage_buffer_map_get;
+    gfx->api.storage_buffer_lock = _gs_render_thread_storage_buffer_lock;
+    gfx->api.storage_buffer_unlock = _gs_render_thread_storage_buffer_unlock;
+    gfx->api.storage_buffer_get_data = _gs_render_thread_storage_buffer_get_data;
+    gfx->api.command_buffer_submit = _gs_render_thread_command_buffer_submit;
+
+    rt->active = true;
+    return true;
+}
+
+GS_API_DECL void
+gs_graphics_render_thread_stop()
+{
+    _gs_render_thread_t* rt = &_gs_render_thread;
+    if (!rt->active) return;
+
+    // Drain the last queued frame, then let the thread release the context
+    gs_semaphore_wait(&rt->frame_done);
+    rt->quit = true;
+    gs_semaphore_post(&rt->wake);
+    gs_thread_join(&rt->thread);
+    rt->active = false;
+
+    gs_graphics()->api = rt->backend.api;
+    if (rt->window) gs_platform_window_make_current_raw(rt->window);
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        gs_byte_buffer_free(&rt->frames[i].commands);
+        gs_dyn_array_free(rt->frames[i].windows);
+    }
+    gs_semaphore_destroy(&rt->frame_done);
+    gs_semaphore_destroy(&rt->call_done);
+    gs_semaphore_destroy(&rt->wake);
+    gs_mutex_destroy(&rt->lock);
+}
+
+GS_API_DECL bool
+gs_graphics_render_thread_active()
+{
+    return _gs_render_thread.active;
+}
+
+GS_API_DECL void
+gs_graphics_render_thread_present()
+{
+    _gs_render_thread_t* rt = &_gs_render_thread;
+    gs_platform_t* platform = gs_subsystem(platform);
+    if (!rt->active) return;
+
+    _gs_render_frame_t* frame = &rt->frames[rt->record];
+    gs_dyn_array_clear(frame->windows);
+    for 
+    (
+        gs_slot_array_iter it = 0;
+        gs_slot_array_iter_valid(platform->windows, it);
+        gs_slot_array_iter_advance(platform->windows, it)
+    )
+    {
+        gs_dyn_array_push(frame->windows, (uint32_t)it);
+    }
+
+    // Frame N-1 must finish before its buffer is recorded into again
+    uint64_t start = gs_platform_elapsed_time_ns();
+    gs_semaphore_wait(&rt->frame_done);
+    rt->stats.wait = (float)(gs_platform_elapsed_time_ns() - start) / 1000000.f;
+    rt->stats.calls = rt->calls;
+    rt->calls = 0;
+
+    rt->pending = frame;
+    rt->record ^= 1;
+    gs_byte_buffer_clear(&rt->frames[rt->record].commands);
+    gs_semaphore_post(&rt->wake);
+}
+
+GS_API_DECL gs_graphics_render_thread_stats_t
+gs_graphics_render_thread_stats()
+{
+    return _gs_render_thread.stats;
+}
+
 /*=============================
 // GS_AUDIO
 =============================*/
@@ -7954,62 +9308,2626 @@ gs_atomic_add(volatile gs_atomic_int_t *dst, int32_t value)
 #endif
 }
 
+GS_API_DECL uint32_t
+gs_atomic_load(volatile uint32_t* src)
+{
+#if defined(_WIN32) && !(defined(__MINGW32__) || defined(__MINGW64__))
+    return (uint32_t)_InterlockedCompareExchange((volatile long*)src, 0, 0);
+#else
+    return __atomic_load_n(src, __ATOMIC_ACQUIRE);
+#endif
+}
+
+GS_API_DECL void
+gs_atomic_store(volatile uint32_t* dst, uint32_t value)
+{
+#if defined(_WIN32) && !(defined(__MINGW32__) || defined(__MINGW64__))
+    _InterlockedExchange((volatile long*)dst, (long)value);
+#else
+    __atomic_store_n(dst, value, __ATOMIC_RELEASE);
+#endif
+}
 
 /*================================================================================
-// Noise
-================================================================================*/ 
+// Threads
+================================================================================*/
 
-#define SG_NOISE_IMPL
-#include "external/sg_noise/sg_noise.h"
+GS_API_PRIVATE uint64_t 
+_gs_os_time_ns()
+{
+#ifdef GS_PLATFORM_WIN
+    LARGE_INTEGER freq, v;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&v);
+    return ((uint64_t)v.QuadPart / freq.QuadPart) * 1000000000ull + 
+        (((uint64_t)v.QuadPart % freq.QuadPart) * 1000000000ull) / freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
 
-// Perlin noise
-GS_API_DECL float 
-gs_perlin1(float x)
+typedef struct _gs_thread_start_t
 {
-    return sg_noise1(x);
+    gs_thread_func_t func;
+    void* data;
+} _gs_thread_start_t;
+
+#ifdef GS_PLATFORM_WIN
+    static DWORD WINAPI _gs_thread_entry(LPVOID arg)
+#else
+    static void* _gs_thread_entry(void* arg)
+#endif
+{
+    _gs_thread_start_t start = *(_gs_thread_start_t*)arg;
+    gs_free(arg);
+    start.func(start.data);
+    return 0;
 }
 
-GS_API_DECL float 
-gs_perlin2(float x, float y)
+GS_API_DECL gs_thread_t 
+gs_thread_create(gs_thread_func_t func, void* data)
 {
-    return sg_noise2(x, y);
+    gs_thread_t thread = gs_default_val();
+    _gs_thread_start_t* start = (_gs_thread_start_t*)gs_malloc(sizeof(_gs_thread_start_t));
+    start->func = func;
+    start->data = data;
+#ifdef GS_PLATFORM_WIN
+    thread.handle = CreateThread(NULL, 0, _gs_thread_entry, start, 0, NULL);
+    thread.valid = thread.handle != NULL;
+#else
+    thread.valid = pthread_create(&thread.handle, NULL, _gs_thread_entry, start) == 0;
+#endif
+    if (!thread.valid) gs_free(start);
+    return thread;
 }
 
-GS_API_DECL float 
-gs_perlin3(float x, float y, float z)
+GS_API_DECL void 
+gs_thread_join(gs_thread_t* thread)
 {
-    return sg_noise3(x, y, z);
+    if (!thread->valid) return;
+#ifdef GS_PLATFORM_WIN
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+    thread->valid = false;
 }
 
-GS_API_DECL float 
-gs_perlin4(float x, float y, float z, float w)
+GS_API_DECL void 
+gs_mutex_init(gs_mutex_t* mutex)
 {
-    return sg_noise4(x, y, z, w);
+#ifdef GS_PLATFORM_WIN
+    InitializeSRWLock(&mutex->lock);
+#else
+    pthread_mutex_init(&mutex->lock, NULL);
+#endif
 }
 
-// Perlin periodic noise
-GS_API_DECL float 
-gs_perlin1p(float x, int32_t px)
+GS_API_DECL void 
+gs_mutex_destroy(gs_mutex_t* mutex)
 {
-    return sg_pnoise1(x, px);
+#ifndef GS_PLATFORM_WIN
+    pthread_mutex_destroy(&mutex->lock);
+#endif
 }
 
-GS_API_DECL float 
-gs_perlin2p(float x, float y, int32_t px, int32_t py)
+GS_API_DECL void 
+gs_mutex_lock(gs_mutex_t* mutex)
 {
-    return sg_pnoise2(x, y, px, py);
+#ifdef GS_PLATFORM_WIN
+    AcquireSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_lock(&mutex->lock);
+#endif
 }
 
-GS_API_DECL float 
-gs_perlin3p(float x, float y, float z, int32_t px, int32_t py, int32_t pz)
+GS_API_DECL void 
+gs_mutex_unlock(gs_mutex_t* mutex)
 {
-    return sg_pnoise3(x, y, z, px, py, pz);
+#ifdef GS_PLATFORM_WIN
+    ReleaseSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_unlock(&mutex->lock);
+#endif
 }
 
-GS_API_DECL float 
-gs_perlin4p(float x, float y, float z, float w, int32_t px, int32_t py, int32_t pz, int32_t pw)
+GS_API_DECL void 
+gs_semaphore_init(gs_semaphore_t* sem, uint32_t count)
 {
-    return sg_pnoise4(x, y, z, w, px, py, pz, pw);
+#ifdef GS_PLATFORM_WIN
+    sem->handle = CreateSemaphore(NULL, (LONG)count, 0x7fffffff, NULL);
+#else
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = count;
+#endif
+}
+
+GS_API_DECL void 
+gs_semaphore_destroy(gs_semaphore_t* sem)
+{
+#ifdef GS_PLATFORM_WIN
+    CloseHandle(sem->handle);
+#else
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+#endif
+}
+
+GS_API_DECL void 
+gs_semaphore_post(gs_semaphore_t* sem)
+{
+#ifdef GS_PLATFORM_WIN
+    ReleaseSemaphore(sem->handle, 1, NULL);
+#else
+    pthread_mutex_lock(&sem->lock);
+    sem->count++;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->lock);
+#endif
+}
+
+GS_API_DECL void 
+gs_semaphore_wait(gs_semaphore_t* sem)
+{
+#ifdef GS_PLATFORM_WIN
+    WaitForSingleObject(sem->handle, INFINITE);
+#else
+    pthread_mutex_lock(&sem->lock);
+    while (!sem->count) pthread_cond_wait(&sem->cond, &sem->lock);
+    sem->count--;
+    pthread_mutex_unlock(&sem->lock);
+#endif
+}
+
+GS_API_DECL bool 
+gs_semaphore_wait_timeout(gs_semaphore_t* sem, uint32_t ms)
+{
+#ifdef GS_PLATFORM_WIN
+    return WaitForSingleObject(sem->handle, ms) == WAIT_OBJECT_0;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += ms / 1000;
+    ts.tv_nsec += (long)(ms % 1000) * 1000000;
+    if (ts.tv_nsec >= 1000000000) {ts.tv_sec++; ts.tv_nsec -= 1000000000;}
+
+    bool ret = true;
+    pthread_mutex_lock(&sem->lock);
+    while (!sem->count) {
+        if (pthread_cond_timedwait(&sem->cond, &sem->lock, &ts) != 0) break;
+    }
+    if (sem->count) sem->count--;
+    else ret = false;
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+#endif
+}
+
+#if (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_ANDROID)
+    #include <sys/prctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+GS_API_DECL void
+gs_thread_set_name(const char* name)
+{
+    if (!name) return;
+#if (defined GS_PLATFORM_WIN)
+    // SetThreadDescription is Windows 10 1607+
+    typedef HRESULT (WINAPI* set_desc_t)(HANDLE, PCWSTR);
+    set_desc_t set_desc = (set_desc_t)GetProcAddress(GetModuleHandleA("kernel32.dll"), "SetThreadDescription");
+    if (set_desc) {
+        wchar_t wname[64] = gs_default_val();
+        MultiByteToWideChar(CP_UTF8, 0, name, -1, wname, 63);
+        set_desc(GetCurrentThread(), wname);
+    }
+#elif (defined GS_PLATFORM_APPLE)
+    pthread_setname_np(name);
+#elif (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_ANDROID)
+    prctl(PR_SET_NAME, name, 0, 0, 0);
+#endif
+#ifdef GS_PROFILE
+    gs_profile_set_thread_name(name);
+#endif
+}
+
+GS_API_DECL bool
+gs_thread_set_affinity(uint32_t core)
+{
+#if (defined GS_PLATFORM_WIN)
+    if (core >= sizeof(DWORD_PTR) * 8) return false;
+    return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << core) != 0;
+#elif (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_ANDROID)
+    unsigned long mask[16] = gs_default_val();
+    const uint32_t bits = sizeof(unsigned long) * 8;
+    if (core >= gs_array_size(mask) * bits) return false;
+    mask[core / bits] |= 1ul << (core % bits);
+    return syscall(SYS_sched_setaffinity, 0, sizeof(mask), mask) == 0;
+#else
+    return false;
+#endif
+}
+
+/*================================================================================
+// Jobs
+================================================================================*/
+
+typedef struct _gs_jobs_t
+{
+    gs_scheduler_t sched;
+    void* memory;
+    gs_jobs_desc_t desc;
+    bool32_t initialized;
+} _gs_jobs_t;
+
+gs_global _gs_jobs_t _gs_jobs = gs_default_val();
+
+// Marks a job whose continuation slot is closed (job finished)
+#define _GS_JOBS_DONE ((gs_job_t*)&_gs_jobs)
+
+GS_API_PRIVATE gs_job_t*
+_gs_jobs_cmp_swp_ptr(gs_job_t* volatile* dst, gs_job_t* swap, gs_job_t* cmp)
+{
+#if defined(_WIN32) && !(defined(__MINGW32__) || defined(__MINGW64__))
+    return (gs_job_t*)_InterlockedCompareExchangePointer((void* volatile*)dst, swap, cmp);
+#else
+    return __sync_val_compare_and_swap(dst, cmp, swap);
+#endif
+}
+
+GS_API_PRIVATE void 
+_gs_jobs_thread_start(void* user_data, sched_uint worker)
+{
+    char name[32] = gs_default_val();
+    gs_snprintf(name, sizeof(name), "%s %u", GS_JOBS_THREAD_NAME, worker);
+    gs_thread_set_name(name);
+    if (_gs_jobs.desc.pin_threads) gs_thread_set_affinity(worker);
+}
+
+GS_API_DECL void
+gs_jobs_init(const gs_jobs_desc_t* desc)
+{
+    if (_gs_jobs.initialized) return;
+
+    gs_jobs_desc_t d = gs_default_val();
+    if (desc) d = *desc;
+    _gs_jobs.desc = d;
+
+    gs_sched_profiling_t prof = gs_default_val();
+    prof.thread_start = _gs_jobs_thread_start;
+
+    sched_size sz = 0;
+    gs_scheduler_init(&_gs_jobs.sched, &sz, d.num_workers ? (sched_int)d.num_workers : GS_SCHED_DEFAULT, &prof);
+    _gs_jobs.memory = gs_malloc(sz);
+    gs_scheduler_start(&_gs_jobs.sched, _gs_jobs.memory);
+    if (d.pin_threads) gs_thread_set_affinity(0);
+    _gs_jobs.initialized = true;
+}
+
+GS_API_DECL void
+gs_jobs_shutdown()
+{
+    if (!_gs_jobs.initialized) return;
+    gs_scheduler_stop(&_gs_jobs.sched, 1);
+    gs_free(_gs_jobs.memory);
+    memset(&_gs_jobs, 0, sizeof(_gs_jobs));
+}
+
+GS_API_DECL uint32_t
+gs_jobs_num_workers()
+{
+    if (!_gs_jobs.initialized) gs_jobs_init(gs_instance() ? &gs_app()->jobs : NULL);
+    return _gs_jobs.sched.threads_num;
+}
+
+GS_API_PRIVATE void _gs_jobs_submit(gs_job_t* job);
+
+GS_API_PRIVATE void
+_gs_jobs_finish(gs_job_t* job)
+{
+    // Close the continuation slot and start whatever was chained
+    gs_job_t* next = job->next;
+    while (_gs_jobs_cmp_swp_ptr(&job->next, _GS_JOBS_DONE, next) != next) next = job->next;
+    if (next) _gs_jobs_submit(next);
+}
+
+GS_API_PRIVATE void
+_gs_jobs_exec(void* data, gs_scheduler_t* sched, gs_sched_task_partition_t p, sched_uint worker)
+{
+    gs_job_t* job = (gs_job_t*)data;
+    const uint32_t n = p.end - p.start;
+    job->func(job->data, p.start, p.end, worker);
+
+    uint32_t old;
+    do {old = job->remaining;} while (gs_atomic_cmp_swp(&job->remaining, old - n, old) != old);
+    if (old == n) _gs_jobs_finish(job);
+}
+
+GS_API_PRIVATE void
+_gs_jobs_submit(gs_job_t* job)
+{
+    if (!job->count) {
+        job->remaining = 0;
+        _gs_jobs_finish(job);
+        return;
+    }
+    gs_scheduler_add(&_gs_jobs.sched, &job->task, _gs_jobs_exec, job, job->count, job->grain);
+}
+
+GS_API_PRIVATE void
+_gs_jobs_prepare(gs_job_t* job, gs_job_func_t func, void* data, uint32_t count, uint32_t grain)
+{
+    if (!_gs_jobs.initialized) gs_jobs_init(gs_instance() ? &gs_app()->jobs : NULL);
+    memset(job, 0, sizeof(gs_job_t));
+    job->func = func;
+    job->data = data;
+    job->count = count;
+    // Default to ~4 ranges per worker so early finishers can steal
+    job->grain = grain ? grain : gs_max(1, count / (_gs_jobs.sched.threads_num * 4));
+    job->remaining = count ? count : 1;
+}
+
+GS_API_DECL void
+gs_jobs_run(gs_job_t* job, gs_job_func_t func, void* data, uint32_t count, uint32_t grain)
+{
+    _gs_jobs_prepare(job, func, data, count, grain);
+    _gs_jobs_submit(job);
+}
+
+GS_API_DECL void
+gs_jobs_then(gs_job_t* job, gs_job_t* next, gs_job_func_t func, void* data, uint32_t count, uint32_t grain)
+{
+    _gs_jobs_prepare(next, func, data, count, grain);
+    gs_job_t* prev = _gs_jobs_cmp_swp_ptr(&job->next, next, NULL);
+    // Already finished, run now; one continuation per job (chain further ones off next)
+    if (prev == _GS_JOBS_DONE) _gs_jobs_submit(next);
+    else gs_assert(prev == NULL);
+}
+
+GS_API_DECL bool32_t
+gs_jobs_done(const gs_job_t* job)
+{
+    // The scheduler touches the task until its run count drops, after remaining does
+    return !gs_atomic_load((volatile uint32_t*)&job->remaining) && gs_sched_task_done(&job->task);
+}
+
+GS_API_DECL void
+gs_jobs_wait(gs_job_t* job)
+{
+    while (!gs_jobs_done(job)) {
+        gs_scheduler_join(&_gs_jobs.sched, NULL);
+    }
+}
+
+GS_API_DECL void
+gs_parallel_for(void* data, gs_job_func_t func, uint32_t count, uint32_t grain)
+{
+    gs_job_t job;
+    gs_jobs_run(&job, func, data, count, grain);
+    gs_jobs_wait(&job);
+}
+
+/*================================================================================
+// Async
+================================================================================*/
+
+typedef enum _gs_async_wait
+{
+    _GS_ASYNC_WAIT_NONE = 0x00,
+    _GS_ASYNC_WAIT_FRAMES,
+    _GS_ASYNC_WAIT_JOB,
+    _GS_ASYNC_WAIT_TASK,
+    _GS_ASYNC_WAIT_IO,
+    _GS_ASYNC_WAIT_WORKER
+} _gs_async_wait;
+
+// Heap allocated so workers and IO callbacks can hold on to it while the slot array grows
+typedef struct _gs_async_task_t
+{
+    gs_coro_t* co;
+    gs_async_func_t func;
+    void* user_data;
+    _gs_async_wait wait;
+    uint32_t frames;
+    uint32_t task;
+    gs_job_t* job;
+    gs_platform_io_result_t* io_result;
+    volatile uint32_t io_done;
+    gs_job_t worker_job;
+    bool32_t on_worker;
+} _gs_async_task_t;
+
+typedef struct _gs_async_t
+{
+    gs_slot_array(_gs_async_task_t*) tasks;    // Slot 0 is reserved so 0 is never a valid id
+} _gs_async_t;
+
+gs_global _gs_async_t _gs_async = gs_default_val();
+
+GS_API_PRIVATE void
+_gs_async_entry(gs_coro_t* co)
+{
+    _gs_async_task_t* t = (_gs_async_task_t*)mco_get_user_data(co);
+    t->func(t->user_data);
+}
+
+GS_API_PRIVATE _gs_async_task_t*
+_gs_async_current()
+{
+    gs_coro_t* co = mco_running();
+    gs_assert(co);
+    return co ? (_gs_async_task_t*)mco_get_user_data(co) : NULL;
+}
+
+GS_API_PRIVATE void
+_gs_async_suspend(_gs_async_task_t* t, _gs_async_wait wait)
+{
+    t->wait = wait;
+    gs_coro_yield(t->co);
+    t->wait = _GS_ASYNC_WAIT_NONE;
+}
+
+GS_API_PRIVATE void
+_gs_async_destroy(_gs_async_task_t* t)
+{
+    gs_coro_destroy(t->co);
+    gs_free(t);
+}
+
+GS_API_DECL uint32_t
+gs_async_run(gs_async_func_t func, void* user_data)
+{
+    if (!func) return 0;
+    if (!_gs_async.tasks) gs_slot_array_insert(_gs_async.tasks, NULL);
+
+    _gs_async_task_t* t = (_gs_async_task_t*)gs_malloc(sizeof(_gs_async_task_t));
+    memset(t, 0, sizeof(_gs_async_task_t));
+    t->func = func;
+    t->user_data = user_data;
+
+    gs_coro_desc_t desc = gs_coro_desc_init(_gs_async_entry, GS_ASYNC_STACK_SIZE);
+    desc.user_data = t;
+    if (gs_coro_create(&t->co, &desc) != GS_CORO_SUCCESS) {
+        gs_free(t);
+        return 0;
+    }
+    return gs_slot_array_insert(_gs_async.tasks, t);
+}
+
+GS_API_DECL bool32_t
+gs_async_done(uint32_t task)
+{
+    return !task || !gs_slot_array_handle_valid(_gs_async.tasks, task);
+}
+
+GS_API_PRIVATE void
+_gs_async_worker_exec(void* data, uint32_t start, uint32_t end, uint32_t worker)
+{
+    _gs_async_task_t* t = (_gs_async_task_t*)data;
+    gs_coro_resume(t->co);
+}
+
+GS_API_PRIVATE bool32_t
+_gs_async_ready(_gs_async_task_t* t)
+{
+    switch (t->wait)
+    {
+        case _GS_ASYNC_WAIT_FRAMES: return !t->frames || !--t->frames;
+        case _GS_ASYNC_WAIT_JOB:    return gs_jobs_done(t->job);
+        case _GS_ASYNC_WAIT_TASK:   return gs_async_done(t->task);
+        case _GS_ASYNC_WAIT_IO:     return gs_atomic_load(&t->io_done);
+        default:                    return true;
+    }
+}
+
+GS_API_DECL uint32_t
+gs_async_update()
+{
+    uint32_t alive = 0;
+    if (!_gs_async.tasks) return 0;
+
+    // Handles are stable across erase, and tasks started this update are picked up as well
+    for (uint32_t id = 1; id < gs_dyn_array_size(_gs_async.tasks->indices); ++id)
+    {
+        if (!gs_slot_array_handle_valid(_gs_async.tasks, id)) continue;
+        _gs_async_task_t* t = gs_slot_array_get(_gs_async.tasks, id);
+
+        if (t->on_worker) {
+            if (!gs_jobs_done(&t->worker_job)) {alive++; continue;}
+            t->on_worker = false;
+        }
+
+        if (gs_coro_status(t->co) != GS_CORO_DEAD && t->wait != _GS_ASYNC_WAIT_WORKER && _gs_async_ready(t)) {
+            gs_coro_resume(t->co);
+        }
+
+        if (gs_coro_status(t->co) == GS_CORO_DEAD) {
+            _gs_async_destroy(t);
+            gs_slot_array_erase(_gs_async.tasks, id);
+            continue;
+        }
+
+        if (t->wait == _GS_ASYNC_WAIT_WORKER) {
+            t->on_worker = true;
+            gs_jobs_run(&t->worker_job, _gs_async_worker_exec, t, 1, 1);
+        }
+        alive++;
+    }
+    return alive;
+}
+
+GS_API_DECL void
+gs_async_shutdown()
+{
+    if (!_gs_async.tasks) return;
+    for (uint32_t id = 1; id < gs_dyn_array_size(_gs_async.tasks->indices); ++id)
+    {
+        if (!gs_slot_array_handle_valid(_gs_async.tasks, id)) continue;
+        _gs_async_task_t* t = gs_slot_array_get(_gs_async.tasks, id);
+        if (t->on_worker) gs_jobs_wait(&t->worker_job);
+        _gs_async_destroy(t);
+    }
+    gs_slot_array_free(_gs_async.tasks);
+}
+
+GS_API_DECL void
+gs_async_await_frames(uint32_t n)
+{
+    _gs_async_task_t* t = _gs_async_current();
+    if (!t) return;
+    t->frames = n;
+    _gs_async_suspend(t, _GS_ASYNC_WAIT_FRAMES);
+}
+
+GS_API_DECL void
+gs_async_await_job(gs_job_t* job)
+{
+    _gs_async_task_t* t = _gs_async_current();
+    if (!t || !job) return;
+    t->job = job;
+    _gs_async_suspend(t, _GS_ASYNC_WAIT_JOB);
+}
+
+GS_API_DECL void
+gs_async_await_task(uint32_t task)
+{
+    _gs_async_task_t* t = _gs_async_current();
+    if (!t) return;
+    t->task = task;
+    _gs_async_suspend(t, _GS_ASYNC_WAIT_TASK);
+}
+
+GS_API_PRIVATE void
+_gs_async_io_callback(gs_platform_io_result_t* result)
+{
+    _gs_async_task_t* t = (_gs_async_task_t*)result->user_data;
+    *t->io_result = *result;
+    t->io_result->path = NULL;
+    result->data = NULL;
+    gs_atomic_store(&t->io_done, 1);
+}
+
+GS_API_DECL bool32_t
+gs_async_await_io(const gs_platform_io_request_desc_t* desc, gs_platform_io_result_t* out)
+{
+    _gs_async_task_t* t = _gs_async_current();
+    if (!t || !desc || !out) return false;
+
+    gs_platform_io_request_desc_t req = *desc;
+    req.callback = _gs_async_io_callback;
+    req.user_data = t;
+    t->io_result = out;
+    t->io_done = 0;
+    if (!gs_platform_io_submit(&req)) {
+        out->status = GS_PLATFORM_IO_STATUS_FAILED;
+        return false;
+    }
+
+    _gs_async_suspend(t, _GS_ASYNC_WAIT_IO);
+    out->user_data = desc->user_data;
+    return out->status == GS_PLATFORM_IO_STATUS_COMPLETE;
+}
+
+GS_API_DECL void
+gs_async_await_worker()
+{
+    _gs_async_task_t* t = _gs_async_current();
+    if (t) _gs_async_suspend(t, _GS_ASYNC_WAIT_WORKER);
+}
+
+GS_API_DECL void
+gs_async_await_main()
+{
+    _gs_async_task_t* t = _gs_async_current();
+    if (t) _gs_async_suspend(t, _GS_ASYNC_WAIT_NONE);
+}
+
+/*================================================================================
+// Profile
+================================================================================*/
+
+typedef struct _gs_profile_event_t
+{
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+} _gs_profile_event_t;
+
+// Written only by the owning thread, read by the exporter up to count
+typedef struct _gs_profile_buffer_t
+{
+    volatile uint32_t count;
+    volatile uint32_t epoch;        // Capture the events belong to
+    uint32_t depth;
+    uint32_t dropped;
+    uint32_t id;
+    struct {
+        const char* name;
+        uint64_t start;
+    } stack[GS_PROFILE_MAX_DEPTH];
+    char name[32];
+    _gs_profile_event_t* events;
+} _gs_profile_buffer_t;
+
+typedef struct _gs_profile_t
+{
+    volatile uint32_t lock;         // Guards registration only
+    volatile uint32_t buffer_count;
+    volatile uint32_t epoch;
+    uint64_t origin;                // Trace timestamps are relative to this
+    _gs_profile_buffer_t* buffers[GS_PROFILE_MAX_THREADS];
+} _gs_profile_t;
+
+gs_global _gs_profile_t _gs_profile = gs_default_val();
+gs_global gs_thread_local _gs_profile_buffer_t* _gs_profile_thread_buffer = NULL;
+
+GS_API_PRIVATE _gs_profile_buffer_t* 
+_gs_profile_register_thread()
+{
+    _gs_profile_buffer_t* buf = NULL;
+    while (gs_atomic_cmp_swp(&_gs_profile.lock, 1, 0) != 0);
+    const uint32_t ct = _gs_profile.buffer_count;
+    if (ct < GS_PROFILE_MAX_THREADS)
+    {
+        buf = (_gs_profile_buffer_t*)gs_malloc(sizeof(_gs_profile_buffer_t));
+        memset(buf, 0, sizeof(_gs_profile_buffer_t));
+        buf->id = ct;
+        buf->epoch = gs_atomic_load(&_gs_profile.epoch);
+        if (!ct) _gs_profile.origin = _gs_os_time_ns();
+        _gs_profile.buffers[ct] = buf;
+        gs_atomic_store(&_gs_profile.buffer_count, ct + 1);
+    }
+    gs_atomic_store(&_gs_profile.lock, 0);
+    _gs_profile_thread_buffer = buf;
+    return buf;
+}
+
+GS_API_DECL void 
+gs_profile_begin_impl(const char* name)
+{
+    _gs_profile_buffer_t* buf = _gs_profile_thread_buffer;
+    if (!buf && !(buf = _gs_profile_register_thread())) return;
+
+    if (buf->depth < GS_PROFILE_MAX_DEPTH) {
+        buf->stack[buf->depth].name = name;
+        buf->stack[buf->depth].start = _gs_os_time_ns();
+    }
+    buf->depth++;
+}
+
+GS_API_DECL void 
+gs_profile_end_impl()
+{
+    _gs_profile_buffer_t* buf = _gs_profile_thread_buffer;
+    if (!buf || !buf->depth) return;
+    if (--buf->depth >= GS_PROFILE_MAX_DEPTH) return;
+
+    const uint64_t end = _gs_os_time_ns();
+
+    // Owner clears its buffer when a new capture started, count first so the exporter never 
+    // pairs the new epoch with old events
+    const uint32_t epoch = gs_atomic_load(&_gs_profile.epoch);
+    if (buf->epoch != epoch) {
+        gs_atomic_store(&buf->count, 0);
+        gs_atomic_store(&buf->epoch, epoch);
+        buf->dropped = 0;
+    }
+
+    const uint32_t i = buf->count;
+    if (i >= GS_PROFILE_MAX_EVENTS) {
+        buf->dropped++;
+        return;
+    }
+    if (!buf->events) {
+        buf->events = (_gs_profile_event_t*)gs_malloc(GS_PROFILE_MAX_EVENTS * sizeof(_gs_profile_event_t));
+    }
+    buf->events[i].name = buf->stack[buf->depth].name;
+    buf->events[i].start = buf->stack[buf->depth].start;
+    buf->events[i].end = end;
+    gs_atomic_store(&buf->count, i + 1);
+}
+
+GS_API_DECL void 
+gs_profile_set_thread_name(const char* name)
+{
+    _gs_profile_buffer_t* buf = _gs_profile_thread_buffer;
+    if (!buf && !(buf = _gs_profile_register_thread())) return;
+    gs_snprintf(buf->name, sizeof(buf->name), "%s", name ? name : "");
+}
+
+GS_API_DECL void 
+gs_profile_reset()
+{
+    gs_atomic_store(&_gs_profile.epoch, _gs_profile.epoch + 1);
+}
+
+GS_API_DECL uint32_t 
+gs_profile_dropped()
+{
+    uint32_t dropped = 0;
+    const uint32_t ct = gs_atomic_load(&_gs_profile.buffer_count);
+    const uint32_t epoch = gs_atomic_load(&_gs_profile.epoch);
+    for (uint32_t i = 0; i < ct; ++i) {
+        _gs_profile_buffer_t* buf = _gs_profile.buffers[i];
+        if (gs_atomic_load(&buf->epoch) == epoch) dropped += buf->dropped;
+    }
+    return dropped;
+}
+
+GS_API_PRIVATE void 
+_gs_profile_write_json_str(FILE* fp, const char* str)
+{
+    fputc('"', fp);
+    for (const char* c = str; c && *c; ++c)
+    {
+        switch (*c)
+        {
+            case '"':  fputs("\\\"", fp); break;
+            case '\\': fputs("\\\\", fp); break;
+            default: {
+                if ((uint8_t)*c < 0x20) fprintf(fp, "\\u%04x", (uint8_t)*c);
+                else fputc(*c, fp);
+            } break;
+        }
+    }
+    fputc('"', fp);
+}
+
+GS_API_DECL bool 
+gs_profile_write_chrome_trace(const char* path)
+{
+    FILE* fp = fopen(path, "wb");
+    if (!fp) {
+        gs_log_warning("gs_profile_write_chrome_trace: unable to open %s", path);
+        return false;
+    }
+
+    const uint32_t ct = gs_atomic_load(&_gs_profile.buffer_count);
+    const uint32_t epoch = gs_atomic_load(&_gs_profile.epoch);
+    const char* sep = "";
+    fprintf(fp, "{\"traceEvents\":[");
+    for (uint32_t i = 0; i < ct; ++i)
+    {
+        _gs_profile_buffer_t* buf = _gs_profile.buffers[i];
+
+        // Thread name metadata
+        char name[32] = gs_default_val();
+        if (buf->name[0]) memcpy(name, buf->name, sizeof(name) - 1);
+        else gs_snprintf(name, sizeof(name), "thread %u", buf->id);
+        fprintf(fp, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":", sep, buf->id);
+        _gs_profile_write_json_str(fp, name);
+        fprintf(fp, "}}");
+        sep = ",";
+
+        if (gs_atomic_load(&buf->epoch) != epoch) continue;
+        const uint32_t n = gs_atomic_load(&buf->count);
+        for (uint32_t e = 0; e < n; ++e)
+        {
+            const _gs_profile_event_t* ev = &buf->events[e];
+            fprintf(fp, ",\n{\"name\":");
+            _gs_profile_write_json_str(fp, ev->name);
+            fprintf(fp, ",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", buf->id, 
+                (double)(int64_t)(ev->start - _gs_profile.origin) / 1000.0, (double)(ev->end - ev->start) / 1000.0);
+        }
+    }
+    fprintf(fp, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(fp);
+    return true;
+}
+
+/*================================================================================
+// Logging
+================================================================================*/
+
+typedef struct _gs_log_record_t
+{
+    uint32_t len;
+    char text[GS_LOG_RECORD_SIZE];
+} _gs_log_record_t;
+
+// Single producer (owning thread) / single consumer (whoever holds the sink lock)
+typedef struct _gs_log_ring_t
+{
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t mask;
+    _gs_log_record_t* records;
+} _gs_log_ring_t;
+
+typedef struct _gs_log_t
+{
+    gs_log_desc_t desc;
+    FILE* fp;
+    bool32_t initialized;
+    uint32_t generation;        // Invalidates thread-cached rings across init/shutdown
+    volatile uint32_t running;
+    volatile uint32_t async;            // Producers may take the async path
+    volatile gs_atomic_int_t writers;   // Producers on the async path, waited out before releasing the rings
+    bool32_t lock_ready;                // The lock lives from the first init on, so late writers can always take it
+    volatile uint32_t ring_count;
+    volatile int32_t dropped;
+    _gs_log_ring_t* rings[GS_LOG_MAX_THREADS];
+    gs_mutex_t lock;            // Serializes sink writes, ring consumption and ring registration
+    gs_semaphore_t wake;
+    gs_thread_t thread;
+} _gs_log_t;
+
+gs_global _gs_log_t _gs_log = gs_default_val();
+gs_global gs_thread_local _gs_log_ring_t* _gs_log_thread_ring = NULL;
+gs_global gs_thread_local uint32_t _gs_log_thread_generation = 0;
+
+gs_force_inline void 
+_gs_log_emit(const char* text, uint32_t len)
+{
+    if (!_gs_log.desc.no_console) gs_printf("%.*s\n", (int)len, text);
+    if (_gs_log.fp) {
+        fwrite(text, 1, len, _gs_log.fp);
+        fputc('\n', _gs_log.fp);
+    }
+}
+
+// Must hold _gs_log.lock
+GS_API_PRIVATE void 
+_gs_log_drain()
+{
+    const uint32_t ct = gs_atomic_load(&_gs_log.ring_count);
+    bool32_t wrote = false;
+    for (uint32_t i = 0; i < ct; ++i)
+    {
+        _gs_log_ring_t* ring = _gs_log.rings[i];
+        uint32_t tail = ring->tail;
+        const uint32_t head = gs_atomic_load(&ring->head);
+        for (; tail != head; ++tail) {
+            _gs_log_record_t* rec = &ring->records[tail & ring->mask];
+            _gs_log_emit(rec->text, rec->len);
+        }
+        if (tail != ring->tail) {
+            gs_atomic_store(&ring->tail, tail);
+            wrote = true;
+        }
+    }
+    if (wrote) {
+        if (!_gs_log.desc.no_console) fflush(stdout);
+        if (_gs_log.fp) fflush(_gs_log.fp);
+    }
+}
+
+GS_API_PRIVATE void 
+_gs_log_thread_func(void* data)
+{
+    while (gs_atomic_load(&_gs_log.running)) {
+        gs_semaphore_wait_timeout(&_gs_log.wake, GS_LOG_FLUSH_INTERVAL_MS);
+        gs_mutex_lock(&_gs_log.lock);
+        _gs_log_drain();
+        gs_mutex_unlock(&_gs_log.lock);
+    }
+}
+
+GS_API_PRIVATE _gs_log_ring_t* 
+_gs_log_register_thread()
+{
+    _gs_log_ring_t* ring = NULL;
+    gs_mutex_lock(&_gs_log.lock);
+    if (_gs_log.ring_count < GS_LOG_MAX_THREADS)
+    {
+        uint32_t cap = 1;
+        while (cap < _gs_log.desc.ring_size) cap <<= 1;
+        ring = (_gs_log_ring_t*)gs_malloc(sizeof(_gs_log_ring_t));
+        memset(ring, 0, sizeof(_gs_log_ring_t));
+        ring->mask = cap - 1;
+        ring->records = (_gs_log_record_t*)gs_malloc(cap * sizeof(_gs_log_record_t));
+        _gs_log.rings[_gs_log.ring_count] = ring;
+        gs_atomic_store(&_gs_log.ring_count, _gs_log.ring_count + 1);
+    }
+    gs_mutex_unlock(&_gs_log.lock);
+    return ring;
+}
+
+GS_API_DECL void 
+gs_log_init(const gs_log_desc_t* desc)
+{
+    if (_gs_log.initialized) gs_log_shutdown();
+
+    if (!_gs_log.lock_ready) {
+        gs_mutex_init(&_gs_log.lock);
+        _gs_log.lock_ready = true;
+    }
+
+    // Synchronous writers may already be emitting under the lock
+    gs_log_desc_t def = gs_default_val();
+    gs_mutex_lock(&_gs_log.lock);
+    _gs_log.desc = desc ? *desc : def;
+    if (!_gs_log.desc.ring_size) _gs_log.desc.ring_size = GS_LOG_RING_SIZE;
+    _gs_log.fp = _gs_log.desc.file_path ? fopen(_gs_log.desc.file_path, "a") : NULL;
+    _gs_log.dropped = 0;
+    gs_mutex_unlock(&_gs_log.lock);
+    gs_semaphore_init(&_gs_log.wake, 0);
+    _gs_log.initialized = true;
+    _gs_log.generation++;
+
+    if (_gs_log.desc.async)
+    {
+        gs_atomic_store(&_gs_log.running, 1);
+        _gs_log.thread = gs_thread_create(_gs_log_thread_func, NULL);
+
+        // No thread support (ex. web without pthreads), fall back to synchronous writes
+        if (!_gs_log.thread.valid) {
+            gs_atomic_store(&_gs_log.running, 0);
+            _gs_log.desc.async = false;
+        }
+    }
+    gs_atomic_store(&_gs_log.async, _gs_log.desc.async ? 1 : 0);
+}
+
+GS_API_DECL void 
+gs_log_shutdown()
+{
+    if (!_gs_log.initialized) return;
+
+    // Stop producers from taking the async path, and wait out those already on it (the add is a full barrier)
+    gs_atomic_store(&_gs_log.async, 0);
+    _gs_log.desc.async = false;
+    while (gs_atomic_add(&_gs_log.writers, 0) != 0) {}
+
+    if (_gs_log.thread.valid) {
+        gs_atomic_store(&_gs_log.running, 0);
+        gs_semaphore_post(&_gs_log.wake);
+        gs_thread_join(&_gs_log.thread);
+    }
+
+    // Final drain before releasing the rings
+    gs_log_flush();
+
+    gs_mutex_lock(&_gs_log.lock);
+    for (uint32_t i = 0; i < _gs_log.ring_count; ++i) {
+        gs_free(_gs_log.rings[i]->records);
+        gs_free(_gs_log.rings[i]);
+        _gs_log.rings[i] = NULL;
+    }
+    gs_atomic_store(&_gs_log.ring_count, 0);
+    if (_gs_log.fp) fclose(_gs_log.fp);
+    _gs_log.fp = NULL;
+    _gs_log.initialized = false;
+    memset(&_gs_log.desc, 0, sizeof(gs_log_desc_t));
+    gs_mutex_unlock(&_gs_log.lock);
+
+    gs_semaphore_destroy(&_gs_log.wake);
+}
+
+GS_API_DECL void 
+gs_log_flush()
+{
+    if (!_gs_log.initialized) {
+        fflush(stdout);
+        return;
+    }
+    gs_mutex_lock(&_gs_log.lock);
+    _gs_log_drain();
+    if (!_gs_log.desc.no_console) fflush(stdout);
+    if (_gs_log.fp) fflush(_gs_log.fp);
+    gs_mutex_unlock(&_gs_log.lock);
+}
+
+GS_API_DECL void 
+gs_log_set_level(gs_log_level level)
+{
+    _gs_log.desc.level = level;
+}
+
+GS_API_DECL uint32_t 
+gs_log_dropped()
+{
+    return (uint32_t)_gs_log.dropped;
+}
+
+// Pre-formats directly into the next free slot of this thread's ring, false if the thread has no ring
+GS_API_PRIVATE bool 
+_gs_log_write_async(gs_log_level level, const char* fmt, va_list args)
+{
+    if (_gs_log_thread_generation != _gs_log.generation) {
+        _gs_log_thread_ring = _gs_log_register_thread();
+        _gs_log_thread_generation = _gs_log.generation;
+    }
+    _gs_log_ring_t* ring = _gs_log_thread_ring;
+    if (!ring) return false;
+
+    const uint32_t head = ring->head;
+    const uint32_t used = head - gs_atomic_load(&ring->tail);
+    if (used > ring->mask) {
+        gs_atomic_add(&_gs_log.dropped, 1);
+        return true;
+    }
+
+    _gs_log_record_t* rec = &ring->records[head & ring->mask];
+    int32_t n = vsnprintf(rec->text, GS_LOG_RECORD_SIZE, fmt, args);
+    rec->len = n < 0 ? 0 : gs_min((uint32_t)n, GS_LOG_RECORD_SIZE - 1);
+    gs_atomic_store(&ring->head, head + 1);
+
+    // Wake the flush thread early once half full, errors are written before returning
+    if (level >= GS_LOG_LEVEL_ERROR) gs_log_flush();
+    else if (used + 1 == (ring->mask + 1) / 2) gs_semaphore_post(&_gs_log.wake);
+    return true;
+}
+
+GS_API_PRIVATE void 
+_gs_log_write_va(gs_log_level level, const char* fmt, va_list args)
+{
+    va_list cpy;
+
+    // Async path, counted so shutdown can wait out writers still using a ring
+    if (gs_atomic_load(&_gs_log.async))
+    {
+        gs_atomic_add(&_gs_log.writers, 1);
+        const bool done = gs_atomic_load(&_gs_log.async) && _gs_log_write_async(level, fmt, args);
+        gs_atomic_add(&_gs_log.writers, -1);
+        if (done) return;
+    }
+
+    // Synchronous path
+    char buf[1024];
+    char* text = buf;
+    va_copy(cpy, args);
+    int32_t n = vsnprintf(buf, sizeof(buf), fmt, cpy);
+    va_end(cpy);
+    if (n < 0) return;
+    if ((size_t)n >= sizeof(buf)) {
+        text = (char*)gs_malloc((size_t)n + 1);
+        vsnprintf(text, (size_t)n + 1, fmt, args);
+    }
+
+    if (_gs_log.lock_ready) {
+        gs_mutex_lock(&_gs_log.lock);
+        _gs_log_emit(text, (uint32_t)n);
+        if (_gs_log.fp && level >= GS_LOG_LEVEL_ERROR) fflush(_gs_log.fp);
+        gs_mutex_unlock(&_gs_log.lock);
+    } else {
+        _gs_log_emit(text, (uint32_t)n);
+    }
+
+    if (text != buf) gs_free(text);
+}
+
+GS_API_DECL void 
+gs_log_write(gs_log_level level, const char* fmt, ...)
+{
+    if (level < _gs_log.desc.level) return;
+
+    va_list args;
+    va_start(args, fmt);
+    _gs_log_write_va(level, fmt, args);
+    va_end(args);
+}
+
+GS_API_DECL void 
+gs_log_print(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    _gs_log_write_va(GS_LOG_LEVEL_INFO, fmt, args);
+    va_end(args);
+}
+
+
+/*================================================================================
+// Platform Async IO
+================================================================================*/
+
+typedef struct _gs_platform_io_req_t
+{
+    gs_platform_io_request_desc_t desc;
+    gs_platform_io_result_t result;
+    char* path;
+    void* write_data;
+    volatile uint32_t cancelled;
+    struct _gs_platform_io_req_t* next;
+} _gs_platform_io_req_t;
+
+typedef struct _gs_platform_io_list_t
+{
+    _gs_platform_io_req_t* head;
+    _gs_platform_io_req_t* tail;
+} _gs_platform_io_list_t;
+
+typedef struct _gs_platform_io_t
+{
+    bool32_t initialized;
+    volatile uint32_t running;
+    uint32_t next_id;
+    uint32_t pending;
+    gs_mutex_t lock;
+    gs_semaphore_t work;
+    _gs_platform_io_list_t queues[GS_PLATFORM_IO_PRIORITY_COUNT];
+    _gs_platform_io_list_t done;
+    gs_dyn_array(gs_thread_t) workers;
+    gs_dyn_array(_gs_platform_io_req_t*) in_flight;    // Indexed by worker
+} _gs_platform_io_t;
+
+gs_global _gs_platform_io_t _gs_platform_io = gs_default_val();
+
+gs_force_inline void 
+_gs_platform_io_list_push(_gs_platform_io_list_t* list, _gs_platform_io_req_t* req)
+{
+    req->next = NULL;
+    if (list->tail) list->tail->next = req;
+    else list->head = req;
+    list->tail = req;
+}
+
+gs_force_inline _gs_platform_io_req_t* 
+_gs_platform_io_list_pop(_gs_platform_io_list_t* list)
+{
+    _gs_platform_io_req_t* req = list->head;
+    if (req) {
+        list->head = req->next;
+        if (!list->head) list->tail = NULL;
+        req->next = NULL;
+    }
+    return req;
+}
+
+GS_API_PRIVATE bool 
+_gs_platform_io_list_remove(_gs_platform_io_list_t* list, _gs_platform_io_req_t* req)
+{
+    _gs_platform_io_req_t* prev = NULL;
+    for (_gs_platform_io_req_t* it = list->head; it; prev = it, it = it->next) {
+        if (it != req) continue;
+        if (prev) prev->next = it->next;
+        else list->head = it->next;
+        if (list->tail == it) list->tail = prev;
+        it->next = NULL;
+        return true;
+    }
+    return false;
+}
+
+GS_API_PRIVATE _gs_platform_io_req_t* 
+_gs_platform_io_list_find(_gs_platform_io_list_t* list, uint32_t id)
+{
+    for (_gs_platform_io_req_t* it = list->head; it; it = it->next) {
+        if (it->result.id == id) return it;
+    }
+    return NULL;
+}
+
+GS_API_PRIVATE void 
+_gs_platform_io_execute(_gs_platform_io_req_t* req)
+{
+    gs_platform_io_result_t* res = &req->result;
+    res->status = GS_PLATFORM_IO_STATUS_FAILED;
+
+    switch (req->desc.op)
+    {
+        case GS_PLATFORM_IO_OP_READ:
+        {
+            res->data = gs_platform_read_file_contents(req->path, "rb", &res->size);
+            if (res->data) res->status = GS_PLATFORM_IO_STATUS_COMPLETE;
+        } break;
+
+        case GS_PLATFORM_IO_OP_READ_RANGE:
+        {
+            const char* path = req->path;
+            #ifdef GS_PLATFORM_ANDROID
+                const char* internal_data_path = gs_app()->android.internal_data_path;
+                gs_snprintfc(tmp_path, 1024, "%s/%s", internal_data_path, req->path);
+                path = tmp_path;
+            #endif
+
+            FILE* fp = fopen(path, "rb");
+            if (!fp) break;
+            #if (defined GS_PLATFORM_WIN)
+                int32_t seek = _fseeki64(fp, (int64_t)req->desc.offset, SEEK_SET);
+            #else
+                int32_t seek = fseeko(fp, (off_t)req->desc.offset, SEEK_SET);
+            #endif
+            if (seek == 0) {
+                char* buffer = (char*)gs_malloc(req->desc.size + 1);
+                res->size = fread(buffer, 1, req->desc.size, fp);
+                buffer[res->size] = '\0';
+                res->data = buffer;
+                res->status = GS_PLATFORM_IO_STATUS_COMPLETE;
+            }
+            fclose(fp);
+        } break;
+
+        case GS_PLATFORM_IO_OP_WRITE:
+        {
+            if (gs_platform_write_file_contents(req->path, "wb", req->write_data, req->desc.size) == GS_RESULT_SUCCESS) {
+                res->size = req->desc.size;
+                res->status = GS_PLATFORM_IO_STATUS_COMPLETE;
+            }
+        } break;
+    }
+}
+
+GS_API_PRIVATE void 
+_gs_platform_io_worker(void* data)
+{
+    _gs_platform_io_t* io = &_gs_platform_io;
+    const uint32_t idx = (uint32_t)(uintptr_t)data;
+    for (;;)
+    {
+        gs_semaphore_wait(&io->work);
+        if (!gs_atomic_load(&io->running)) break;
+
+        // Highest priority first, FIFO within a priority
+        gs_mutex_lock(&io->lock);
+        _gs_platform_io_req_t* req = NULL;
+        for (int32_t p = GS_PLATFORM_IO_PRIORITY_COUNT - 1; p >= 0 && !req; --p) {
+            req = _gs_platform_io_list_pop(&io->queues[p]);
+        }
+        io->in_flight[idx] = req;
+        gs_mutex_unlock(&io->lock);
+
+        // Semaphore count can outlive requests removed by cancellation
+        if (!req) continue;
+
+        _gs_platform_io_execute(req);
+
+        gs_mutex_lock(&io->lock);
+        io->in_flight[idx] = NULL;
+        _gs_platform_io_list_push(&io->done, req);
+        gs_mutex_unlock(&io->lock);
+
+        // Completion is delivered at the next frame, don't let idle mode sleep through it
+        gs_platform_wake();
+    }
+}
+
+GS_API_DECL void 
+gs_platform_io_init(uint32_t worker_count)
+{
+    _gs_platform_io_t* io = &_gs_platform_io;
+    if (io->initialized) return;
+
+    if (!worker_count) worker_count = GS_PLATFORM_IO_DEFAULT_WORKERS;
+    gs_mutex_init(&io->lock);
+    gs_semaphore_init(&io->work, 0);
+    io->next_id = 1;
+    io->initialized = true;
+    gs_atomic_store(&io->running, 1);
+
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        gs_dyn_array_push(io->in_flight, NULL);
+        gs_thread_t thread = gs_thread_create(_gs_platform_io_worker, (void*)(uintptr_t)i);
+        if (!thread.valid) break;
+        gs_dyn_array_push(io->workers, thread);
+    }
+}
+
+GS_API_DECL void 
+gs_platform_io_shutdown()
+{
+    _gs_platform_io_t* io = &_gs_platform_io;
+    if (!io->initialized) return;
+
+    gs_atomic_store(&io->running, 0);
+    for (uint32_t i = 0; i < gs_dyn_array_size(io->workers); ++i) {
+        gs_semaphore_post(&io->work);
+    }
+    for (uint32_t i = 0; i < gs_dyn_array_size(io->workers); ++i) {
+        gs_thread_join(&io->workers[i]);
+    }
+
+    // Drop anything left without callbacks (application has already shutdown)
+    for (uint32_t p = 0; p <= GS_PLATFORM_IO_PRIORITY_COUNT; ++p) {
+        _gs_platform_io_list_t* list = p < GS_PLATFORM_IO_PRIORITY_COUNT ? &io->queues[p] : &io->done;
+        _gs_platform_io_req_t* req = NULL;
+        while ((req = _gs_platform_io_list_pop(list))) {
+            if (req->result.data) gs_free(req->result.data);
+            if (req->write_data) gs_free(req->write_data);
+            gs_free(req->path);
+            gs_free(req);
+        }
+    }
+
+    gs_dyn_array_free(io->workers);
+    gs_dyn_array_free(io->in_flight);
+    gs_semaphore_destroy(&io->work);
+    gs_mutex_destroy(&io->lock);
+    memset(io, 0, sizeof(_gs_platform_io_t));
+}
+
+GS_API_DECL uint32_t 
+gs_platform_io_submit(const gs_platform_io_request_desc_t* desc)
+{
+    _gs_platform_io_t* io = &_gs_platform_io;
+    if (!desc || !desc->path) return 0;
+    if (!io->initialized) gs_platform_io_init(gs_instance() ? gs_app()->io_workers : 0);
+
+    _gs_platform_io_req_t* req = (_gs_platform_io_req_t*)gs_malloc(sizeof(_gs_platform_io_req_t));
+    memset(req, 0, sizeof(_gs_platform_io_req_t));
+    req->desc = *desc;
+    req->desc.priority = (gs_platform_io_priority)gs_clamp(desc->priority, GS_PLATFORM_IO_PRIORITY_LOW, GS_PLATFORM_IO_PRIORITY_HIGH);
+    const size_t path_len = strlen(desc->path);
+    req->path = (char*)gs_malloc(path_len + 1);
+    memcpy(req->path, desc->path, path_len + 1);
+    if (desc->op == GS_PLATFORM_IO_OP_WRITE && desc->size) {
+        req->write_data = gs_malloc(desc->size);
+        memcpy(req->write_data, desc->data, desc->size);
+    }
+    req->result.op = desc->op;
+    req->result.path = req->path;
+    req->result.user_data = desc->user_data;
+
+    gs_mutex_lock(&io->lock);
+    req->result.id = io->next_id++;
+    if (!io->next_id) io->next_id = 1;
+    io->pending++;
+    const uint32_t id = req->result.id;
+
+    // No workers (threads unavailable), execute now and deliver at next dispatch
+    if (!gs_dyn_array_size(io->workers)) {
+        gs_mutex_unlock(&io->lock);
+        _gs_platform_io_execute(req);
+        gs_mutex_lock(&io->lock);
+        _gs_platform_io_list_push(&io->done, req);
+        gs_mutex_unlock(&io->lock);
+        return id;
+    }
+
+    _gs_platform_io_list_push(&io->queues[req->desc.priority], req);
+    gs_mutex_unlock(&io->lock);
+    gs_semaphore_post(&io->work);
+    return id;
+}
+
+GS_API_DECL bool 
+gs_platform_io_cancel(uint32_t id)
+{
+    _gs_platform_io_t* io = &_gs_platform_io;
+    if (!io->initialized || !id) return false;
+
+    bool found = false;
+    gs_mutex_lock(&io->lock);
+
+    // Queued: move straight to done
+    for (uint32_t p = 0; p < GS_PLATFORM_IO_PRIORITY_COUNT && !found; ++p) {
+        _gs_platform_io_req_t* req = _gs_platform_io_list_find(&io->queues[p], id);
+        if (req) {
+            _gs_platform_io_list_remove(&io->queues[p], req);
+            req->cancelled = true;
+            _gs_platform_io_list_push(&io->done, req);
+            found = true;
+        }
+    }
+
+    // In flight or awaiting dispatch: flag, result is discarded at dispatch
+    for (uint32_t i = 0; i < gs_dyn_array_size(io->in_flight) && !found; ++i) {
+        if (io->in_flight[i] && io->in_flight[i]->result.id == id) {
+            io->in_flight[i]->cancelled = true;
+            found = true;
+        }
+    }
+    if (!found) {
+        _gs_platform_io_req_t* req = _gs_platform_io_list_find(&io->done, id);
+        if (req) {
+            req->cancelled = true;
+            found = true;
+        }
+    }
+
+    gs_mutex_unlock(&io->lock);
+    return found;
+}
+
+GS_API_DECL uint32_t 
+gs_platform_io_dispatch()
+{
+    _gs_platform_io_t* io = &_gs_platform_io;
+    if (!io->initialized) return 0;
+
+    gs_mutex_lock(&io->lock);
+    _gs_platform_io_list_t done = io->done;
+    io->done.head = io->done.tail = NULL;
+    gs_mutex_unlock(&io->lock);
+
+    uint32_t ct = 0;
+    _gs_platform_io_req_t* req = NULL;
+    while ((req = _gs_platform_io_list_pop(&done)))
+    {
+        gs_platform_io_result_t* res = &req->result;
+        if (req->cancelled) {
+            if (res->data) gs_free(res->data);
+            res->data = NULL;
+            res->size = 0;
+            res->status = GS_PLATFORM_IO_STATUS_CANCELLED;
+        }
+        if (req->desc.callback) req->desc.callback(res);
+        if (res->data) gs_free(res->data);
+        if (req->write_data) gs_free(req->write_data);
+        gs_free(req->path);
+        gs_free(req);
+        ct++;
+    }
+
+    gs_mutex_lock(&io->lock);
+    io->pending -= ct;
+    gs_mutex_unlock(&io->lock);
+    return ct;
+}
+
+GS_API_DECL uint32_t 
+gs_platform_io_pending()
+{
+    return _gs_platform_io.pending;
+}
+
+/*================================================================================
+// Platform Archives
+================================================================================*/
+
+#if !(defined GS_PLATFORM_WIN)
+    #include <dirent.h>
+#else
+    #include "external/dirent/dirent.h"
+#endif
+
+#define _GS_PLATFORM_ARCHIVE_MAGIC              0x4B505347  // "GSPK"
+#define _GS_PLATFORM_ARCHIVE_VERSION            1
+#define _GS_PLATFORM_ARCHIVE_ENTRY_COMPRESSED   (1 << 0)
+
+// On-disk layout (little endian)
+typedef struct _gs_platform_archive_header_t
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t reserved;
+    uint64_t strings_offset;
+    uint64_t index_offset;
+} _gs_platform_archive_header_t;
+
+typedef struct _gs_platform_archive_entry_t
+{
+    uint64_t hash;          // gs_hash_bytes_fast64() of normalized path, index is sorted by this
+    uint64_t offset;        // Entry data, from start of archive
+    uint64_t size;          // Stored size
+    uint64_t raw_size;      // Uncompressed size
+    uint32_t path;          // Offset of '\0' terminated path into string table
+    uint32_t flags;
+} _gs_platform_archive_entry_t;
+
+typedef struct _gs_platform_archive_t
+{
+    uint32_t hndl;
+    gs_platform_file_map_t map;
+    const _gs_platform_archive_entry_t* entries;
+    uint32_t entry_count;
+    const char* strings;
+} _gs_platform_archive_t;
+
+gs_global gs_dyn_array(_gs_platform_archive_t) _gs_platform_archives = NULL;
+gs_global uint32_t _gs_platform_archive_next_hndl = 1;
+
+// Forward slashes, no leading "./", returns length or -1 if it does not fit
+GS_API_PRIVATE int32_t 
+_gs_platform_archive_normalize(const char* path, char* out, size_t cap)
+{
+    while (path[0] == '.' && (path[1] == '/' || path[1] == '\\')) path += 2;
+    size_t len = 0;
+    for (; path[len]; ++len) {
+        if (len + 1 >= cap) return -1;
+        out[len] = path[len] == '\\' ? '/' : path[len];
+    }
+    out[len] = '\0';
+    return (int32_t)len;
+}
+
+GS_API_PRIVATE const _gs_platform_archive_entry_t* 
+_gs_platform_archive_find(const char* path, _gs_platform_archive_t** out_ar)
+{
+    if (!gs_dyn_array_size(_gs_platform_archives) || !path) return NULL;
+
+    char npath[1024];
+    int32_t len = _gs_platform_archive_normalize(path, npath, sizeof(npath));
+    if (len < 0) return NULL;
+    const uint64_t hash = gs_hash_bytes_fast64(npath, (size_t)len, 0);
+
+    // Most recently mounted first
+    for (int32_t a = (int32_t)gs_dyn_array_size(_gs_platform_archives) - 1; a >= 0; --a)
+    {
+        _gs_platform_archive_t* ar = &_gs_platform_archives[a];
+
+        // Lower bound on hash, then resolve collisions by path
+        uint32_t lo = 0, hi = ar->entry_count;
+        while (lo < hi) {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (ar->entries[mid].hash < hash) lo = mid + 1;
+            else hi = mid;
+        }
+        for (; lo < ar->entry_count && ar->entries[lo].hash == hash; ++lo) {
+            if (strcmp(ar->strings + ar->entries[lo].path, npath) == 0) {
+                if (out_ar) *out_ar = ar;
+                return &ar->entries[lo];
+            }
+        }
+    }
+    return NULL;
+}
+
+// Reads loose file from disk, bypassing mounted archives
+GS_API_PRIVATE uint8_t* 
+_gs_platform_archive_read_disk(const char* path, size_t* sz)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp) return NULL;
+    fseek(fp, 0, SEEK_END);
+    long len = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t* buffer = len >= 0 ? (uint8_t*)gs_malloc((size_t)len + 1) : NULL;
+    if (buffer) *sz = fread(buffer, 1, (size_t)len, fp);
+    fclose(fp);
+    return buffer;
+}
+
+gs_force_inline int32_t 
+_gs_platform_archive_entry_cmp(const void* a, const void* b)
+{
+    const uint64_t ha = ((const _gs_platform_archive_entry_t*)a)->hash;
+    const uint64_t hb = ((const _gs_platform_archive_entry_t*)b)->hash;
+    return ha < hb ? -1 : ha > hb ? 1 : 0;
+}
+
+GS_API_DECL bool 
+gs_platform_archive_pack(const char* out_path, const gs_platform_archive_pack_desc_t* desc)
+{
+    if (!out_path || !desc) return false;
+
+    FILE* fp = fopen(out_path, "wb");
+    if (!fp) {
+        gs_log_warning("Unable to open archive for writing: %s", out_path);
+        return false;
+    }
+
+    const uint32_t ct = (uint32_t)(desc->size / sizeof(gs_platform_archive_entry_desc_t));
+    gs_dyn_array(_gs_platform_archive_entry_t) entries = NULL;
+    gs_byte_buffer_t strings = gs_byte_buffer_new();
+    static const uint8_t zeros[GS_PLATFORM_ARCHIVE_ALIGN] = gs_default_val();
+    bool ret = true;
+
+    _gs_platform_archive_header_t header = gs_default_val();
+    fwrite(&header, sizeof(header), 1, fp);
+    uint64_t offset = sizeof(header);
+
+    for (uint32_t i = 0; i < ct; ++i)
+    {
+        const gs_platform_archive_entry_desc_t* ed = &desc->entries[i];
+        char npath[1024];
+        int32_t len = ed->path ? _gs_platform_archive_normalize(ed->path, npath, sizeof(npath)) : -1;
+        const char* src_path = ed->src_path ? ed->src_path : ed->path;
+        size_t raw_sz = 0;
+        uint8_t* raw = len >= 0 ? _gs_platform_archive_read_disk(src_path, &raw_sz) : NULL;
+        if (!raw) {
+            gs_log_warning("Unable to pack file: %s", src_path ? src_path : "(null)");
+            ret = false;
+            continue;
+        }
+
+        _gs_platform_archive_entry_t e = gs_default_val();
+        e.hash = gs_hash_bytes_fast64(npath, (size_t)len, 0);
+        e.raw_size = raw_sz;
+        e.path = (uint32_t)strings.size;
+        gs_byte_buffer_write_bulk(&strings, npath, (size_t)len + 1);
+
+        // Keep compressed data only if it is worth the decompression
+        const uint8_t* data = raw;
+        e.size = raw_sz;
+        uint8_t* cmp = NULL;
+        if (desc->compress && raw_sz > 64) {
+            size_t bound = gs_util_lz_compress_bound(raw_sz);
+            cmp = (uint8_t*)gs_malloc(bound);
+            size_t csz = gs_util_lz_compress(raw, raw_sz, cmp, bound);
+            if (csz && csz <= raw_sz - raw_sz / 8) {
+                data = cmp;
+                e.size = csz;
+                e.flags |= _GS_PLATFORM_ARCHIVE_ENTRY_COMPRESSED;
+            }
+        }
+
+        // Data, then at least one '\0' up to the next alignment boundary
+        e.offset = offset;
+        fwrite(data, 1, (size_t)e.size, fp);
+        offset += e.size;
+        size_t pad = GS_PLATFORM_ARCHIVE_ALIGN - (size_t)(offset % GS_PLATFORM_ARCHIVE_ALIGN);
+        fwrite(zeros, 1, pad, fp);
+        offset += pad;
+
+        gs_dyn_array_push(entries, e);
+        if (cmp) gs_free(cmp);
+        gs_free(raw);
+    }
+
+    qsort(entries, gs_dyn_array_size(entries), sizeof(_gs_platform_archive_entry_t), _gs_platform_archive_entry_cmp);
+
+    // Reject duplicate paths
+    for (uint32_t i = 1; i < gs_dyn_array_size(entries); ++i) {
+        for (uint32_t j = i; j > 0 && entries[j - 1].hash == entries[i].hash; --j) {
+            const char* a = (const char*)strings.data + entries[i].path;
+            if (strcmp(a, (const char*)strings.data + entries[j - 1].path) == 0) {
+                gs_log_warning("Duplicate path in archive: %s", a);
+                ret = false;
+            }
+        }
+    }
+
+    header.magic = _GS_PLATFORM_ARCHIVE_MAGIC;
+    header.version = _GS_PLATFORM_ARCHIVE_VERSION;
+    header.entry_count = gs_dyn_array_size(entries);
+    header.strings_offset = offset;
+    fwrite(strings.data, 1, strings.size, fp);
+    offset += strings.size;
+    size_t pad = (8 - (size_t)(offset % 8)) % 8;
+    fwrite(zeros, 1, pad, fp);
+    offset += pad;
+    header.index_offset = offset;
+    fwrite(entries, sizeof(_gs_platform_archive_entry_t), header.entry_count, fp);
+    offset += sizeof(_gs_platform_archive_entry_t) * header.entry_count;
+
+    // Page-aligned sizes can't be mapped with a zero tail (see gs_platform_file_map())
+    if (offset % 4096 == 0) fwrite(zeros, 1, 1, fp);
+
+    fseek(fp, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, fp);
+    fclose(fp);
+
+    gs_dyn_array_free(entries);
+    gs_byte_buffer_free(&strings);
+    return ret;
+}
+
+GS_API_PRIVATE void 
+_gs_platform_archive_collect(const char* dir_path, gs_dyn_array(char*)* paths)
+{
+    DIR* dir = opendir(dir_path);
+    if (!dir) return;
+    struct dirent* ent = NULL;
+    while ((ent = readdir(dir)))
+    {
+        if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+        size_t len = strlen(dir_path) + strlen(ent->d_name) + 2;
+        char* path = (char*)gs_malloc(len);
+        snprintf(path, len, "%s/%s", dir_path, ent->d_name);
+        if (gs_platform_dir_exists(path)) {
+            _gs_platform_archive_collect(path, paths);
+            gs_free(path);
+        } else {
+            gs_dyn_array_push(*paths, path);
+        }
+    }
+    closedir(dir);
+}
+
+GS_API_DECL bool 
+gs_platform_archive_pack_dir(const char* out_path, const char* dir_path, bool32_t compress)
+{
+    gs_dyn_array(char*) paths = NULL;
+    _gs_platform_archive_collect(dir_path, &paths);
+
+    gs_dyn_array(gs_platform_archive_entry_desc_t) entries = NULL;
+    for (uint32_t i = 0; i < gs_dyn_array_size(paths); ++i) {
+        gs_platform_archive_entry_desc_t e = gs_default_val();
+        e.path = paths[i];
+        gs_dyn_array_push(entries, e);
+    }
+
+    gs_platform_archive_pack_desc_t desc = gs_default_val();
+    desc.entries = entries;
+    desc.size = gs_dyn_array_size(entries) * sizeof(gs_platform_archive_entry_desc_t);
+    desc.compress = compress;
+    bool ret = gs_platform_archive_pack(out_path, &desc);
+
+    for (uint32_t i = 0; i < gs_dyn_array_size(paths); ++i) gs_free(paths[i]);
+    gs_dyn_array_free(paths);
+    gs_dyn_array_free(entries);
+    return ret;
+}
+
+GS_API_DECL uint32_t 
+gs_platform_archive_mount(const char* archive_path)
+{
+    _gs_platform_archive_t ar = gs_default_val();
+    ar.map = gs_platform_file_map(archive_path);
+    if (!ar.map.data) {
+        gs_log_warning("Unable to mount archive: %s", archive_path);
+        return 0;
+    }
+
+    // Validate everything up front, lookups trust the index
+    const _gs_platform_archive_header_t* h = (const _gs_platform_archive_header_t*)ar.map.data;
+    const uint64_t sz = ar.map.size;
+    bool valid = sz >= sizeof(_gs_platform_archive_header_t) && 
+        h->magic == _GS_PLATFORM_ARCHIVE_MAGIC && h->version == _GS_PLATFORM_ARCHIVE_VERSION &&
+        h->strings_offset <= h->index_offset && h->index_offset % 8 == 0 && 
+        h->index_offset <= sz && (sz - h->index_offset) / sizeof(_gs_platform_archive_entry_t) >= h->entry_count;
+    if (valid) {
+        ar.entries = (const _gs_platform_archive_entry_t*)(ar.map.data + h->index_offset);
+        ar.entry_count = h->entry_count;
+        ar.strings = ar.map.data + h->strings_offset;
+        const uint64_t strings_sz = h->index_offset - h->strings_offset;
+        for (uint32_t i = 0; i < ar.entry_count && valid; ++i) {
+            const _gs_platform_archive_entry_t* e = &ar.entries[i];
+            valid = e->offset <= h->strings_offset && e->size < h->strings_offset - e->offset && 
+                e->path < strings_sz && memchr(ar.strings + e->path, '\0', (size_t)(strings_sz - e->path)) &&
+                (i == 0 || ar.entries[i - 1].hash <= e->hash);
+
+            // Stored entries are read and mapped in place for raw_size bytes plus the terminator
+            if (valid && !(e->flags & _GS_PLATFORM_ARCHIVE_ENTRY_COMPRESSED)) {
+                valid = e->raw_size == e->size && ar.map.data[e->offset + e->size] == '\0';
+            }
+        }
+    }
+    if (!valid) {
+        gs_log_warning("Invalid archive: %s", archive_path);
+        gs_platform_file_unmap(&ar.map);
+        return 0;
+    }
+
+    ar.hndl = _gs_platform_archive_next_hndl++;
+    gs_dyn_array_push(_gs_platform_archives, ar);
+    return ar.hndl;
+}
+
+GS_API_DECL void 
+gs_platform_archive_unmount(uint32_t hndl)
+{
+    const uint32_t ct = gs_dyn_array_size(_gs_platform_archives);
+    for (uint32_t i = 0; i < ct; ++i) 
+    {
+        if (_gs_platform_archives[i].hndl != hndl) continue;
+        gs_platform_file_unmap(&_gs_platform_archives[i].map);
+
+        // Keep mount order
+        memmove(&_gs_platform_archives[i], &_gs_platform_archives[i + 1], (ct - i - 1) * sizeof(_gs_platform_archive_t));
+        gs_dyn_array_pop(_gs_platform_archives);
+        break;
+    }
+    if (!gs_dyn_array_size(_gs_platform_archives)) {
+        gs_dyn_array_free(_gs_platform_archives);
+        _gs_platform_archives = NULL;
+    }
+}
+
+GS_API_DECL bool 
+gs_platform_archive_contains(const char* path)
+{
+    return _gs_platform_archive_find(path, NULL) != NULL;
+}
+
+GS_API_DECL int32_t 
+gs_platform_archive_file_size(const char* path)
+{
+    const _gs_platform_archive_entry_t* e = _gs_platform_archive_find(path, NULL);
+    return e ? (int32_t)e->raw_size : -1;
+}
+
+GS_API_DECL char* 
+gs_platform_archive_read(const char* path, size_t* sz)
+{
+    _gs_platform_archive_t* ar = NULL;
+    const _gs_platform_archive_entry_t* e = _gs_platform_archive_find(path, &ar);
+    if (!e) return NULL;
+
+    char* buffer = (char*)gs_malloc((size_t)e->raw_size + 1);
+    const char* src = ar->map.data + e->offset;
+    if (e->flags & _GS_PLATFORM_ARCHIVE_ENTRY_COMPRESSED) {
+        if (gs_util_lz_decompress(src, (size_t)e->size, buffer, (size_t)e->raw_size) != e->raw_size) {
+            gs_log_warning("Corrupt archive entry: %s", path);
+            gs_free(buffer);
+            return NULL;
+        }
+    } else {
+        memcpy(buffer, src, (size_t)e->raw_size);
+    }
+    buffer[e->raw_size] = '\0';
+    if (sz) *sz = (size_t)e->raw_size;
+    return buffer;
+}
+
+GS_API_DECL bool 
+gs_platform_archive_map(const char* path, gs_platform_file_map_t* map)
+{
+    _gs_platform_archive_t* ar = NULL;
+    const _gs_platform_archive_entry_t* e = _gs_platform_archive_find(path, &ar);
+    if (!e) return false;
+
+    memset(map, 0, sizeof(gs_platform_file_map_t));
+    if (e->flags & _GS_PLATFORM_ARCHIVE_ENTRY_COMPRESSED) {
+        map->data = gs_platform_archive_read(path, &map->size);
+        map->heap = true;
+        return map->data != NULL;
+    }
+
+    // In place, packer guarantees the trailing '\0'
+    map->data = ar->map.data + e->offset;
+    map->size = (size_t)e->raw_size;
+    map->archive = true;
+    return true;
+}
+
+/*================================================================================
+// Platform File Watch
+================================================================================*/
+
+#if (defined GS_PLATFORM_LINUX)
+    #include <sys/inotify.h>
+    #include <unistd.h>
+    #define _GS_PLATFORM_FILE_WATCH_INOTIFY
+#endif
+
+typedef struct _gs_platform_file_watch_t
+{
+    uint32_t hndl;
+    char* path;
+    const char* name;               // File name part of path
+    int32_t wd;                     // inotify watch descriptor of parent directory
+    uint64_t modified_time;         // Polling
+    int32_t size;                   // Polling (modified time can have 1s resolution)
+    bool32_t exists;                // Polling
+    bool32_t pending;
+    gs_platform_file_watch_event evt;
+    double last_event;
+    gs_platform_file_watch_cb_t cb; // NULL once unwatched during dispatch
+    void* user_data;
+} _gs_platform_file_watch_t;
+
+typedef struct _gs_platform_file_watcher_t
+{
+    gs_dyn_array(_gs_platform_file_watch_t) watches;
+    uint32_t next_hndl;
+    int32_t fd;
+    bool32_t initialized;
+    bool32_t dispatching;
+    double last_poll;
+} _gs_platform_file_watcher_t;
+
+gs_global _gs_platform_file_watcher_t _gs_platform_file_watcher = gs_default_val();
+
+gs_force_inline double 
+_gs_platform_file_watch_now()
+{
+    return gs_instance() ? gs_platform_elapsed_time() : 0.0;
+}
+
+GS_API_PRIVATE void 
+_gs_platform_file_watch_poll_stats(_gs_platform_file_watch_t* w)
+{
+    w->exists = gs_util_file_exists(w->path);
+    w->modified_time = w->exists ? gs_platform_file_stats(w->path).modified_time : 0;
+    w->size = w->exists ? gs_platform_file_size_in_bytes(w->path) : 0;
+}
+
+GS_API_PRIVATE void 
+_gs_platform_file_watch_free(_gs_platform_file_watch_t* w)
+{
+#ifdef _GS_PLATFORM_FILE_WATCH_INOTIFY
+    _gs_platform_file_watcher_t* fw = &_gs_platform_file_watcher;
+    bool32_t shared = false;
+    for (uint32_t i = 0; i < gs_dyn_array_size(fw->watches); ++i) {
+        _gs_platform_file_watch_t* o = &fw->watches[i];
+        if (o != w && o->cb && o->wd == w->wd) shared = true;
+    }
+    if (!shared && w->wd >= 0 && fw->fd >= 0) inotify_rm_watch(fw->fd, w->wd);
+#endif
+    gs_free(w->path);
+}
+
+GS_API_DECL uint32_t 
+gs_platform_file_watch(const char* path, gs_platform_file_watch_cb_t cb, void* user_data)
+{
+    _gs_platform_file_watcher_t* fw = &_gs_platform_file_watcher;
+    if (!path || !cb) return 0;
+
+    if (!fw->initialized) {
+        fw->next_hndl = 1;
+        fw->fd = -1;
+        #ifdef _GS_PLATFORM_FILE_WATCH_INOTIFY
+            fw->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        #endif
+        fw->last_poll = _gs_platform_file_watch_now();
+        fw->initialized = true;
+    }
+
+    _gs_platform_file_watch_t w = gs_default_val();
+    const size_t len = strlen(path);
+    w.path = (char*)gs_malloc(len + 1);
+    memcpy(w.path, path, len + 1);
+    const char* slash = strrchr(w.path, '/');
+    w.name = slash ? slash + 1 : w.path;
+    w.wd = -1;
+    w.cb = cb;
+    w.user_data = user_data;
+    _gs_platform_file_watch_poll_stats(&w);
+
+#ifdef _GS_PLATFORM_FILE_WATCH_INOTIFY
+    // Directory watches share a descriptor, files are matched by name
+    if (fw->fd >= 0) {
+        char dir[1024] = ".";
+        if (slash && slash != w.path) {
+            size_t dlen = gs_min((size_t)(slash - w.path), sizeof(dir) - 1);
+            memcpy(dir, w.path, dlen);
+            dir[dlen] = '\0';
+        } else if (slash) {
+            memcpy(dir, "/", 2);
+        }
+        w.wd = inotify_add_watch(fw->fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE);
+    }
+#endif
+
+    w.hndl = fw->next_hndl++;
+    gs_dyn_array_push(fw->watches, w);
+    return w.hndl;
+}
+
+GS_API_DECL void 
+gs_platform_file_unwatch(uint32_t hndl)
+{
+    _gs_platform_file_watcher_t* fw = &_gs_platform_file_watcher;
+    for (uint32_t i = 0; i < gs_dyn_array_size(fw->watches); ++i)
+    {
+        _gs_platform_file_watch_t* w = &fw->watches[i];
+        if (w->hndl != hndl || !w->cb) continue;
+
+        // Compacted after dispatch completes
+        if (fw->dispatching) {
+            w->cb = NULL;
+            return;
+        }
+
+        _gs_platform_file_watch_free(w);
+        fw->watches[i] = gs_dyn_array_back(fw->watches);
+        gs_dyn_array_pop(fw->watches);
+        return;
+    }
+}
+
+GS_API_PRIVATE void 
+_gs_platform_file_watch_mark(_gs_platform_file_watch_t* w, gs_platform_file_watch_event evt, double now)
+{
+    w->pending = true;
+    w->evt = evt;
+    w->last_event = now;
+}
+
+GS_API_DECL uint32_t 
+gs_platform_file_watch_update()
+{
+    _gs_platform_file_watcher_t* fw = &_gs_platform_file_watcher;
+    if (!fw->initialized || !gs_dyn_array_size(fw->watches)) return 0;
+
+    const double now = _gs_platform_file_watch_now();
+
+#ifdef _GS_PLATFORM_FILE_WATCH_INOTIFY
+    if (fw->fd >= 0)
+    {
+        char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+        ssize_t len;
+        while ((len = read(fw->fd, buffer, sizeof(buffer))) > 0)
+        {
+            for (char* at = buffer; at < buffer + len; at += sizeof(struct inotify_event) + ((struct inotify_event*)at)->len)
+            {
+                const struct inotify_event* ev = (const struct inotify_event*)at;
+                for (uint32_t i = 0; i < gs_dyn_array_size(fw->watches); ++i)
+                {
+                    _gs_platform_file_watch_t* w = &fw->watches[i];
+                    if (ev->mask & IN_Q_OVERFLOW) {
+                        _gs_platform_file_watch_mark(w, GS_PLATFORM_FILE_WATCH_MODIFIED, now);
+                    }
+                    else if (w->wd == ev->wd && ev->len && strcmp(ev->name, w->name) == 0) {
+                        gs_platform_file_watch_event evt = (ev->mask & (IN_DELETE | IN_MOVED_FROM)) ? 
+                            GS_PLATFORM_FILE_WATCH_DELETED : GS_PLATFORM_FILE_WATCH_MODIFIED;
+                        _gs_platform_file_watch_mark(w, evt, now);
+                    }
+                }
+            }
+        }
+    }
+#endif
+    if (now - fw->last_poll >= GS_PLATFORM_FILE_WATCH_POLL_MS)
+    {
+        // Polling fallback, also covers watches inotify couldn't add (missing directory, watch limit)
+        fw->last_poll = now;
+        for (uint32_t i = 0; i < gs_dyn_array_size(fw->watches); ++i)
+        {
+            _gs_platform_file_watch_t* w = &fw->watches[i];
+#ifdef _GS_PLATFORM_FILE_WATCH_INOTIFY
+            if (fw->fd >= 0 && w->wd >= 0) continue;
+#endif
+            const bool32_t existed = w->exists;
+            const uint64_t mtime = w->modified_time;
+            const int32_t size = w->size;
+            _gs_platform_file_watch_poll_stats(w);
+            if (existed && !w->exists) _gs_platform_file_watch_mark(w, GS_PLATFORM_FILE_WATCH_DELETED, now);
+            else if (w->exists && (!existed || w->modified_time != mtime || w->size != size)) _gs_platform_file_watch_mark(w, GS_PLATFORM_FILE_WATCH_MODIFIED, now);
+        }
+    }
+
+    // Deliver files that have settled
+    uint32_t ct = 0;
+    fw->dispatching = true;
+    for (uint32_t i = 0; i < gs_dyn_array_size(fw->watches); ++i)
+    {
+        _gs_platform_file_watch_t* w = &fw->watches[i];
+        if (!w->pending || !w->cb || now - w->last_event < GS_PLATFORM_FILE_WATCH_DEBOUNCE_MS) continue;
+        w->pending = false;
+
+        // Callback may push new watches and reallocate the array
+        gs_platform_file_watch_cb_t cb = w->cb;
+        void* user_data = w->user_data;
+        gs_platform_file_watch_event evt = w->evt;
+        cb(fw->watches[i].path, evt, user_data);
+        ct++;
+    }
+    fw->dispatching = false;
+
+    // Remove watches released during dispatch
+    for (uint32_t i = 0; i < gs_dyn_array_size(fw->watches);) {
+        if (fw->watches[i].cb) {
+            ++i;
+            continue;
+        }
+        _gs_platform_file_watch_free(&fw->watches[i]);
+        fw->watches[i] = gs_dyn_array_back(fw->watches);
+        gs_dyn_array_pop(fw->watches);
+    }
+
+    return ct;
+}
+
+GS_API_DECL void 
+gs_platform_file_watch_shutdown()
+{
+    _gs_platform_file_watcher_t* fw = &_gs_platform_file_watcher;
+    if (!fw->initialized) return;
+    for (uint32_t i = 0; i < gs_dyn_array_size(fw->watches); ++i) {
+        gs_free(fw->watches[i].path);
+    }
+    gs_dyn_array_free(fw->watches);
+#ifdef _GS_PLATFORM_FILE_WATCH_INOTIFY
+    if (fw->fd >= 0) close(fw->fd);
+#endif
+    memset(fw, 0, sizeof(_gs_platform_file_watcher_t));
+}
+
+/*================================================================================
+// Platform Frame Pacing
+================================================================================*/
+
+GS_API_DECL void
+gs_platform_set_frame_pacing(gs_platform_frame_pacing mode)
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    platform->pacer.mode = mode;
+    platform->pacer.deadline = 0;
+}
+
+GS_API_DECL uint64_t
+gs_platform_ticks()
+{
+    gs_t* inst = gs_instance();
+    const uint64_t epoch = (inst && inst->ctx.platform) ? inst->ctx.platform->time.epoch : 0;
+    return gs_platform_elapsed_time_ns() - epoch;
+}
+
+GS_API_DECL uint64_t
+gs_platform_ticks_frequency()
+{
+    return GS_PLATFORM_TICKS_PER_SECOND;
+}
+
+// Derives the ms fields from ticks, differences are taken in ticks before converting
+GS_API_PRIVATE void
+_gs_platform_time_sync(gs_platform_time_t* t)
+{
+    t->elapsed  = (float)gs_platform_ticks_to_ms(t->ticks);
+    t->previous = (float)gs_platform_ticks_to_ms(t->previous_ticks);
+    t->update   = (float)gs_platform_ticks_to_ms(t->update_ticks);
+    t->render   = (float)gs_platform_ticks_to_ms(t->render_ticks);
+    t->frame    = (float)gs_platform_ticks_to_ms(t->frame_ticks);
+    t->delta    = (float)gs_platform_ticks_to_sec(t->frame_ticks);
+}
+
+GS_API_PRIVATE void
+_gs_platform_frame_wait(uint64_t deadline, gs_platform_frame_pacing mode)
+{
+    uint64_t now = gs_platform_elapsed_time_ns();
+    if (now >= deadline) return;
+
+    if (mode == GS_PLATFORM_FRAME_PACING_SLEEP) {
+        gs_platform_sleep((float)((double)(deadline - now) / 1000000.0));
+        return;
+    }
+
+    // Sleep can overshoot by a millisecond or more, so only sleep up to the spin margin
+    const uint64_t spin = (uint64_t)(GS_PLATFORM_FRAME_SPIN_MS * 1000000.0);
+    if (deadline - now > spin) {
+        gs_platform_sleep((float)((double)(deadline - now - spin) / 1000000.0));
+    }
+    while (gs_platform_elapsed_time_ns() < deadline) {
+        sched_pause();
+    }
+}
+
+GS_API_DECL void
+gs_platform_frame_pace()
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    gs_platform_frame_pacer_t* pacer = &platform->pacer;
+    const float max_fps = platform->time.max_fps;
+    const uint64_t period = (max_fps > 0.f && pacer->mode != GS_PLATFORM_FRAME_PACING_NONE) ? 
+        (uint64_t)(1000000000.0 / max_fps) : 0;
+
+    // Virtual time lands exactly on the deadline, so nothing waits
+    if (platform->headless.virtual_clock) {
+        platform->headless.time += period ? period : (uint64_t)(1000000000.0 / (max_fps > 0.f ? max_fps : 60.f));
+    }
+
+    if (period && pacer->deadline) {
+        if (gs_platform_elapsed_time_ns() > pacer->deadline) pacer->missed++;
+        else _gs_platform_frame_wait(pacer->deadline, pacer->mode);
+    }
+
+    // Schedule from the previous deadline so oversleep doesn't accumulate as drift, 
+    // resync once a full period behind
+    const uint64_t now = gs_platform_elapsed_time_ns();
+    if (period) {
+        pacer->deadline = (pacer->deadline && now < pacer->deadline + period) ? pacer->deadline + period : now + period;
+    } else {
+        pacer->deadline = 0;
+    }
+
+    if (pacer->last) {
+        platform->time.frame_ticks = now - pacer->last;
+        pacer->history[pacer->head] = (float)gs_platform_ticks_to_ms(platform->time.frame_ticks);
+        pacer->head = (pacer->head + 1) % GS_PLATFORM_FRAME_HISTORY;
+        pacer->count = gs_min(pacer->count + 1, GS_PLATFORM_FRAME_HISTORY);
+        _gs_platform_time_sync(&platform->time);
+    }
+    pacer->last = now;
+}
+
+/*================================================================================
+// Platform Idle
+================================================================================*/
+
+GS_API_DECL void
+gs_platform_set_idle(bool32_t enabled)
+{
+    gs_platform_idle_t* idle = &gs_subsystem(platform)->idle;
+    idle->enabled = enabled;
+    idle->active = GS_PLATFORM_IDLE_SETTLE_FRAMES;
+}
+
+GS_API_DECL void
+gs_platform_set_idle_timeout(float ms)
+{
+    gs_subsystem(platform)->idle.timeout = ms;
+}
+
+GS_API_DECL void
+gs_platform_request_redraw()
+{
+    gs_t* inst = gs_instance();
+    if (!inst || !inst->ctx.platform) return;
+    inst->ctx.platform->idle.redraw = 1;
+}
+
+GS_API_DECL void
+gs_platform_wake()
+{
+    gs_t* inst = gs_instance();
+    if (!inst || !inst->ctx.platform) return;
+    gs_platform_idle_t* idle = &inst->ctx.platform->idle;
+
+    // First waker since the last resume stamps the latency
+    if (gs_atomic_cmp_swp(&idle->woken, 1, 0) == 0) {
+        idle->wake_time = gs_platform_elapsed_time_ns();
+    }
+    idle->redraw = 1;
+    if (!inst->ctx.platform->headless.enabled) gs_platform_wake_internal();
+}
+
+GS_API_DECL gs_platform_idle_stats_t
+gs_platform_idle_stats()
+{
+    return gs_subsystem(platform)->idle.stats;
+}
+
+// Blocks before the frame if the previous ones were quiet, the wait is kept out of the frame timing
+GS_API_PRIVATE void
+_gs_platform_idle_wait(gs_platform_t* platform)
+{
+    gs_platform_idle_t* idle = &platform->idle;
+    if (!idle->enabled || platform->headless.virtual_clock || platform->input_log.mode != GS_PLATFORM_INPUT_LOG_NONE) return;
+    const bool32_t redraw = gs_atomic_cmp_swp(&idle->redraw, 0, 1) == 1;
+    if (redraw || idle->active || gs_dyn_array_size(platform->injected)) {
+        if (idle->active) idle->active--;
+        gs_atomic_cmp_swp(&idle->woken, 0, 1);     // Wakes that arrive while drawing aren't latency samples
+        return;
+    }
+
+    // Watches are polled from the frame, don't sleep through them
+    float timeout = idle->timeout;
+    if (gs_dyn_array_size(_gs_platform_file_watcher.watches)) {
+        timeout = timeout > 0.f ? gs_min(timeout, (float)GS_PLATFORM_FILE_WATCH_POLL_MS) : (float)GS_PLATFORM_FILE_WATCH_POLL_MS;
+    }
+
+    const uint64_t start = gs_platform_elapsed_time_ns();
+    if (platform->headless.enabled) {
+        // No event source, poll for wakes
+        const uint64_t end = timeout > 0.f ? start + gs_platform_ms_to_ticks(timeout) : UINT64_MAX;
+        while (!idle->redraw && gs_platform_elapsed_time_ns() < end) {
+            gs_platform_sleep(1.f);
+        }
+    } else {
+        gs_platform_wait_events(timeout);
+    }
+    const uint64_t now = gs_platform_elapsed_time_ns();
+    const uint64_t waited = now - start;
+
+    idle->stats.idle_frames++;
+    idle->stats.wait = (float)gs_platform_ticks_to_ms(waited);
+    if (gs_atomic_cmp_swp(&idle->woken, 0, 1) == 1) {
+        idle->stats.wakes++;
+        idle->stats.wake_latency = now > idle->wake_time ? (float)gs_platform_ticks_to_ms(now - idle->wake_time) : 0.f;
+        idle->stats.wake_latency_max = gs_max(idle->stats.wake_latency_max, idle->stats.wake_latency);
+    }
+    gs_atomic_cmp_swp(&idle->redraw, 0, 1);
+
+    // Blocked time is neither frame time nor a missed deadline
+    platform->time.previous_ticks += waited;
+    if (platform->pacer.last) platform->pacer.last += waited;
+    platform->pacer.deadline = 0;
+}
+
+// Anything that changed this frame keeps the loop drawing for a few more
+GS_API_PRIVATE void
+_gs_platform_idle_update(gs_platform_t* platform, bool32_t activity)
+{
+    gs_platform_idle_t* idle = &platform->idle;
+    if (activity) idle->active = GS_PLATFORM_IDLE_SETTLE_FRAMES;
+}
+
+GS_API_PRIVATE int32_t
+_gs_platform_frame_cmp(const void* a, const void* b)
+{
+    const float fa = *(const float*)a, fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+GS_API_DECL gs_platform_frame_stats_t
+gs_platform_frame_stats()
+{
+    gs_platform_frame_pacer_t* pacer = &gs_subsystem(platform)->pacer;
+    gs_platform_frame_stats_t stats = gs_default_val();
+    float sorted[GS_PLATFORM_FRAME_HISTORY];
+    const uint32_t n = pacer->count;
+
+    stats.frames = n;
+    stats.missed = pacer->missed;
+    if (!n) return stats;
+
+    memcpy(sorted, pacer->history, n * sizeof(float));
+    qsort(sorted, n, sizeof(float), _gs_platform_frame_cmp);
+    stats.p50 = sorted[(n - 1) * 50 / 100];
+    stats.p95 = sorted[(n - 1) * 95 / 100];
+    stats.p99 = sorted[(n - 1) * 99 / 100];
+    stats.max = sorted[n - 1];
+    return stats;
+}
+
+/*================================================================================
+// Platform Headless
+================================================================================*/
+
+GS_API_DECL bool32_t
+gs_platform_headless()
+{
+    return gs_subsystem(platform)->headless.enabled;
+}
+
+GS_API_DECL void
+gs_platform_inject_event(const gs_platform_event_t* evt)
+{
+    if (!evt) return;
+    gs_dyn_array_push(gs_subsystem(platform)->injected, *evt);
+}
+
+GS_API_PRIVATE void
+_gs_platform_flush_injected(gs_platform_t* platform)
+{
+    for (uint32_t i = 0; i < gs_dyn_array_size(platform->injected); ++i) {
+        gs_platform_add_event(&platform->injected[i]);
+    }
+    gs_dyn_array_clear(platform->injected);
+}
+
+/*================================================================================
+// Platform Input Log
+================================================================================*/
+
+#define GS_PLATFORM_INPUT_LOG_MAGIC     0x52495347  // "GSIR"
+#define GS_PLATFORM_INPUT_LOG_VERSION   2
+#define GS_PLATFORM_INPUT_LOG_WORDS     (sizeof(gs_platform_input_t) / sizeof(uint32_t))
+
+typedef struct _gs_platform_input_log_header_t
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t input_size;    // Logs are raw structs, only valid for the same build layout
+    uint32_t event_size;
+    uint32_t frames;
+    float accumulator;      // Fixed-update accumulator at the first frame
+} _gs_platform_input_log_header_t;
+
+GS_API_DECL gs_result
+gs_platform_input_record_begin(const char* path)
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    gs_platform_input_log_t* log = &platform->input_log;
+    if (!path || log->mode != GS_PLATFORM_INPUT_LOG_NONE) return GS_RESULT_FAILURE;
+
+    _gs_platform_input_log_header_t header = gs_default_val();
+    header.magic = GS_PLATFORM_INPUT_LOG_MAGIC;
+    header.version = GS_PLATFORM_INPUT_LOG_VERSION;
+    header.input_size = sizeof(gs_platform_input_t);
+    header.event_size = sizeof(gs_platform_event_t);
+    header.accumulator = platform->pacer.accumulator;
+
+    log->buffer = gs_byte_buffer_new();
+    gs_byte_buffer_write(&log->buffer, _gs_platform_input_log_header_t, header);
+    gs_snprintf(log->path, sizeof(log->path), "%s", path);
+    memset(&log->prev, 0, sizeof(log->prev));
+    log->frame = 0;
+    log->mode = GS_PLATFORM_INPUT_LOG_RECORD;
+    return GS_RESULT_SUCCESS;
+}
+
+GS_API_DECL gs_result
+gs_platform_input_record_end()
+{
+    gs_platform_input_log_t* log = &gs_subsystem(platform)->input_log;
+    if (log->mode != GS_PLATFORM_INPUT_LOG_RECORD) return GS_RESULT_FAILURE;
+
+    // Frame count is only known now
+    ((_gs_platform_input_log_header_t*)log->buffer.data)->frames = log->frame;
+    gs_result res = gs_byte_buffer_write_to_file(&log->buffer, log->path);
+    gs_byte_buffer_free(&log->buffer);
+    log->mode = GS_PLATFORM_INPUT_LOG_NONE;
+    return res;
+}
+
+GS_API_DECL gs_result
+gs_platform_input_replay_begin(const char* path, bool32_t fast)
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    gs_platform_input_log_t* log = &platform->input_log;
+    if (!path || log->mode != GS_PLATFORM_INPUT_LOG_NONE || !gs_platform_file_exists(path)) {
+        return GS_RESULT_FAILURE;
+    }
+
+    gs_byte_buffer_t buffer = gs_default_val();
+    if (gs_byte_buffer_read_from_file(&buffer, path) != GS_RESULT_SUCCESS) return GS_RESULT_FAILURE;
+
+    _gs_platform_input_log_header_t header = gs_default_val();
+    if (buffer.size >= sizeof(header)) {
+        gs_byte_buffer_read(&buffer, _gs_platform_input_log_header_t, &header);
+    }
+    if (
+        header.magic != GS_PLATFORM_INPUT_LOG_MAGIC || 
+        header.version != GS_PLATFORM_INPUT_LOG_VERSION ||
+        header.input_size != sizeof(gs_platform_input_t) || 
+        header.event_size != sizeof(gs_platform_event_t)
+    ) {
+        gs_log_warning("Input log %s is invalid or from a different build.", path);
+        gs_byte_buffer_free(&buffer);
+        return GS_RESULT_FAILURE;
+    }
+
+    log->buffer = buffer;
+    log->frame = 0;
+    log->frames = header.frames;
+    log->fast = fast;
+    log->pacing = platform->pacer.mode;
+    memset(&log->prev, 0, sizeof(log->prev));
+    platform->pacer.accumulator = header.accumulator;
+    if (fast) platform->pacer.mode = GS_PLATFORM_FRAME_PACING_NONE;
+    log->mode = GS_PLATFORM_INPUT_LOG_REPLAY;
+    return GS_RESULT_SUCCESS;
+}
+
+GS_API_DECL void
+gs_platform_input_replay_end()
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    gs_platform_input_log_t* log = &platform->input_log;
+    if (log->mode != GS_PLATFORM_INPUT_LOG_REPLAY) return;
+    if (log->fast) platform->pacer.mode = log->pacing;
+    gs_byte_buffer_free(&log->buffer);
+    log->mode = GS_PLATFORM_INPUT_LOG_NONE;
+}
+
+GS_API_DECL gs_platform_input_log_mode
+gs_platform_input_log_get_mode()
+{
+    return gs_subsystem(platform)->input_log.mode;
+}
+
+GS_API_PRIVATE void
+_gs_platform_input_record_frame(gs_platform_t* platform)
+{
+    gs_platform_input_log_t* log = &platform->input_log;
+    gs_byte_buffer_t* bb = &log->buffer;
+    const uint32_t* curr = (const uint32_t*)&platform->input;
+    uint32_t* prev = (uint32_t*)&log->prev;
+
+    gs_byte_buffer_write(bb, uint64_t, platform->time.ticks);
+    gs_byte_buffer_write(bb, uint64_t, platform->time.frame_ticks);
+
+    // Count is patched once the changed words are known
+    const uint32_t count_pos = bb->position;
+    uint16_t changed = 0;
+    gs_byte_buffer_write(bb, uint16_t, changed);
+    for (uint16_t i = 0; i < GS_PLATFORM_INPUT_LOG_WORDS; ++i) {
+        if (curr[i] == prev[i]) continue;
+        gs_byte_buffer_write(bb, uint16_t, i);
+        gs_byte_buffer_write(bb, uint32_t, curr[i]);
+        prev[i] = curr[i];
+        changed++;
+    }
+    memcpy(bb->data + count_pos, &changed, sizeof(changed));
+
+    gs_platform_event_queue_t* q = &platform->events;
+    gs_byte_buffer_write(bb, uint16_t, (uint16_t)(q->tail - q->head));
+    for (uint32_t i = q->head; i != q->tail; ++i) {
+        gs_platform_event_t evt = q->data[i & q->mask];
+        evt.idx = 0;
+        gs_byte_buffer_write(bb, gs_platform_event_t, evt);
+    }
+
+    log->frame++;
+}
+
+gs_force_inline bool32_t
+_gs_platform_input_log_has(gs_byte_buffer_t* bb, size_t sz)
+{
+    return bb->position + sz <= bb->size;
+}
+
+GS_API_PRIVATE void
+_gs_platform_input_replay_frame(gs_platform_t* platform)
+{
+    gs_platform_input_log_t* log = &platform->input_log;
+    gs_byte_buffer_t* bb = &log->buffer;
+    uint32_t* prev = (uint32_t*)&log->prev;
+    uint16_t changed = 0, count = 0;
+
+    // Truncated logs end the replay at the last whole frame
+    if (log->frame >= log->frames || !_gs_platform_input_log_has(bb, 2 * sizeof(uint64_t) + sizeof(uint16_t))) {
+        gs_platform_input_replay_end();
+        return;
+    }
+
+    gs_byte_buffer_read(bb, uint64_t, &platform->time.ticks);
+    gs_byte_buffer_read(bb, uint64_t, &platform->time.frame_ticks);
+    _gs_platform_time_sync(&platform->time);
+
+    gs_byte_buffer_read(bb, uint16_t, &changed);
+    for (uint16_t i = 0; i < changed && _gs_platform_input_log_has(bb, sizeof(uint16_t) + sizeof(uint32_t)); ++i) {
+        uint16_t word = 0;
+        uint32_t value = 0;
+        gs_byte_buffer_read(bb, uint16_t, &word);
+        gs_byte_buffer_read(bb, uint32_t, &value);
+        if (word < GS_PLATFORM_INPUT_LOG_WORDS) prev[word] = value;
+    }
+    platform->input = log->prev;
+
+    // Logged events replace whatever the native pump produced
+    gs_platform_clear_events();
+    if (_gs_platform_input_log_has(bb, sizeof(uint16_t))) {
+        gs_byte_buffer_read(bb, uint16_t, &count);
+    }
+    for (uint16_t i = 0; i < count && _gs_platform_input_log_has(bb, sizeof(gs_platform_event_t)); ++i) {
+        gs_platform_event_t evt = gs_default_val();
+        gs_byte_buffer_read(bb, gs_platform_event_t, &evt);
+        gs_platform_add_event(&evt);
+    }
+
+    if (++log->frame >= log->frames) {
+        gs_platform_input_replay_end();
+    }
+}
+
+GS_API_PRIVATE void
+_gs_platform_input_log_frame(gs_platform_t* platform)
+{
+    switch (platform->input_log.mode)
+    {
+        case GS_PLATFORM_INPUT_LOG_RECORD: _gs_platform_input_record_frame(platform); break;
+        case GS_PLATFORM_INPUT_LOG_REPLAY: _gs_platform_input_replay_frame(platform); break;
+        default: break;
+    }
+}
+
+/*================================================================================
+// Noise
+================================================================================*/ 
+
+#define SG_NOISE_IMPL
+#include "external/sg_noise/sg_noise.h"
+
+// Perlin noise
+GS_API_DECL float 
+gs_perlin1(float x)
+{
+    return sg_noise1(x);
+}
+
+GS_API_DECL float 
+gs_perlin2(float x, float y)
+{
+    return sg_noise2(x, y);
+}
+
+GS_API_DECL float 
+gs_perlin3(float x, float y, float z)
+{
+    return sg_noise3(x, y, z);
+}
+
+GS_API_DECL float 
+gs_perlin4(float x, float y, float z, float w)
+{
+    return sg_noise4(x, y, z, w);
+}
+
+// Perlin periodic noise
+GS_API_DECL float 
+gs_perlin1p(float x, int32_t px)
+{
+    return sg_pnoise1(x, px);
+}
+
+GS_API_DECL float 
+gs_perlin2p(float x, float y, int32_t px, int32_t py)
+{
+    return sg_pnoise2(x, y, px, py);
+}
+
+GS_API_DECL float 
+gs_perlin3p(float x, float y, float z, int32_t px, int32_t py, int32_t pz)
+{
+    return sg_pnoise3(x, y, z, px, py, pz);
+}
+
+GS_API_DECL float 
+gs_perlin4p(float x, float y, float z, float w, int32_t px, int32_t py, int32_t pz, int32_t pw)
+{
+    return sg_pnoise4(x, y, z, w, px, py, pz, pw);
 }
 
 /*=============================
@@ -8265,14 +12183,13 @@ gs_read_file_contents_into_string_null_term
 
 bool32_t gs_util_load_texture_data_from_file(const char* file_path, int32_t* width, int32_t* height, uint32_t* num_comps, void** data, bool32_t flip_vertically_on_load)
 {
-    size_t len = 0;
-    char* file_data = gs_platform_read_file_contents(file_path, "rb", &len);
-    gs_assert(file_data);
-    bool32_t ret = gs_util_load_texture_data_from_memory(file_data, len, width, height, num_comps, data, flip_vertically_on_load);
+    gs_platform_file_map_t map = gs_platform_file_map(file_path);
+    gs_assert(map.data);
+    bool32_t ret = gs_util_load_texture_data_from_memory(map.data, map.size, width, height, num_comps, data, flip_vertically_on_load);
     if (!ret) {
         gs_println("Warning: could not load texture: %s", file_path);
     }
-    gs_free(file_data);
+    gs_platform_file_unmap(&map);
     return ret;
 }
 
@@ -8289,6 +12206,165 @@ gs_util_load_texture_data_from_memory(const void* memory, size_t sz, int32_t* wi
     return true;
 }
 
+#define _GS_LZ_MIN_MATCH    4
+#define _GS_LZ_MAX_OFFSET   65535
+#define _GS_LZ_HASH_BITS    14
+
+gs_force_inline uint32_t 
+_gs_lz_read32(const uint8_t* p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+gs_force_inline uint8_t* 
+_gs_lz_write_len(uint8_t* op, size_t len)
+{
+    for (; len >= 255; len -= 255) *op++ = 255;
+    *op++ = (uint8_t)len;
+    return op;
+}
+
+GS_API_DECL size_t 
+gs_util_lz_compress_bound(size_t sz)
+{
+    return sz + sz / 255 + 16;
+}
+
+GS_API_DECL size_t 
+gs_util_lz_compress(const void* src, size_t src_sz, void* dst, size_t dst_cap)
+{
+    const uint8_t* base = (const uint8_t*)src;
+    const uint8_t* ip = base;
+    const uint8_t* anchor = base;
+    const uint8_t* end = base + src_sz;
+    uint8_t* op = (uint8_t*)dst;
+    uint8_t* oend = op + dst_cap;
+
+    uint32_t* table = (uint32_t*)gs_calloc(1u << _GS_LZ_HASH_BITS, sizeof(uint32_t));
+    uint32_t misses = 0;
+
+    while (src_sz >= _GS_LZ_MIN_MATCH && ip + _GS_LZ_MIN_MATCH <= end)
+    {
+        const uint32_t seq = _gs_lz_read32(ip);
+        const uint32_t h = (seq * 2654435761u) >> (32 - _GS_LZ_HASH_BITS);
+        const uint8_t* ref = base + table[h];
+        table[h] = (uint32_t)(ip - base);
+
+        if (ref >= ip || (size_t)(ip - ref) > _GS_LZ_MAX_OFFSET || _gs_lz_read32(ref) != seq) {
+            // Skip faster through incompressible data
+            ip += 1 + (misses++ >> 5);
+            continue;
+        }
+        misses = 0;
+
+        size_t mlen = _GS_LZ_MIN_MATCH;
+        while (ip + mlen < end && ref[mlen] == ip[mlen]) mlen++;
+
+        const size_t lit = (size_t)(ip - anchor);
+        if ((size_t)(oend - op) < 1 + lit + lit / 255 + 2 + mlen / 255 + 2) {
+            gs_free(table);
+            return 0;
+        }
+
+        const size_t ml = mlen - _GS_LZ_MIN_MATCH;
+        uint8_t* token = op++;
+        *token = (uint8_t)((gs_min(lit, 15) << 4) | gs_min(ml, 15));
+        if (lit >= 15) op = _gs_lz_write_len(op, lit - 15);
+        memcpy(op, anchor, lit);
+        op += lit;
+        const uint16_t off = (uint16_t)(ip - ref);
+        *op++ = (uint8_t)(off & 0xff);
+        *op++ = (uint8_t)(off >> 8);
+        if (ml >= 15) op = _gs_lz_write_len(op, ml - 15);
+
+        ip += mlen;
+        anchor = ip;
+    }
+    gs_free(table);
+
+    // Trailing literals, sequence without a match
+    const size_t lit = (size_t)(end - anchor);
+    if ((size_t)(oend - op) < 1 + lit + lit / 255 + 1) return 0;
+    *op++ = (uint8_t)(gs_min(lit, 15) << 4);
+    if (lit >= 15) op = _gs_lz_write_len(op, lit - 15);
+    memcpy(op, anchor, lit);
+    op += lit;
+
+    return (size_t)(op - (uint8_t*)dst);
+}
+
+GS_API_DECL size_t 
+gs_util_lz_decompress(const void* src, size_t src_sz, void* dst, size_t dst_sz)
+{
+    const uint8_t* ip = (const uint8_t*)src;
+    const uint8_t* iend = ip + src_sz;
+    uint8_t* op = (uint8_t*)dst;
+    uint8_t* oend = op + dst_sz;
+
+    while (ip < iend)
+    {
+        const uint8_t token = *ip++;
+
+        // Literals
+        size_t lit = token >> 4;
+        if (lit == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) return 0;
+                b = *ip++;
+                lit += b;
+            } while (b == 255);
+        }
+        if ((size_t)(iend - ip) >= 16 + 2 && (size_t)(oend - op) >= 16 && lit <= 16) {
+            // Short literals with room on both sides, fixed size copy
+            memcpy(op, ip, 16);
+        } else {
+            if (lit > (size_t)(iend - ip) || lit > (size_t)(oend - op)) return 0;
+            memcpy(op, ip, lit);
+        }
+        op += lit;
+        ip += lit;
+
+        // Last sequence has no match
+        if (ip >= iend) break;
+
+        // Match
+        if (iend - ip < 2) return 0;
+        const size_t off = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        size_t mlen = token & 15;
+        if (mlen == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) return 0;
+                b = *ip++;
+                mlen += b;
+            } while (b == 255);
+        }
+        mlen += _GS_LZ_MIN_MATCH;
+        if (!off || off > (size_t)(op - (uint8_t*)dst) || mlen > (size_t)(oend - op)) return 0;
+
+        const uint8_t* ref = op - off;
+        if (off >= 8 && (size_t)(oend - op) >= mlen + 8) {
+            // Non-overlapping 8 byte chunks, may write up to 7 bytes past the match (within dst)
+            uint8_t* mend = op + mlen;
+            do {
+                memcpy(op, ref, 8);
+                op += 8;
+                ref += 8;
+            } while (op < mend);
+            op = mend;
+        } else {
+            for (size_t i = 0; i < mlen; ++i) op[i] = ref[i];
+            op += mlen;
+        }
+    }
+
+    return (size_t)(op - (uint8_t*)dst);
+}
+
 
 /*==========================
 // GS_ASSET_TYPES
@@ -8312,17 +12388,17 @@ gs_asset_texture_load_from_file(const char* path, void* out, gs_graphics_texture
     }
 
     // Load texture data
-    FILE* f = fopen(path, "rb");
-    if (!f) {
+    gs_platform_file_map_t map = gs_platform_file_map(path);
+    if (!map.data) {
         return false;
     }
 
     int32_t comp = 0;
     stbi_set_flip_vertically_on_load(t->desc.flip_y);
-    *t->desc.data = (uint8_t*)stbi_load_from_file(f, (int32_t*)&t->desc.width, (int32_t*)&t->desc.height, (int32_t*)&comp, STBI_rgb_alpha);
+    *t->desc.data = (uint8_t*)stbi_load_from_memory((const stbi_uc*)map.data, (int32_t)map.size, (int32_t*)&t->desc.width, (int32_t*)&t->desc.height, (int32_t*)&comp, STBI_rgb_alpha);
+    gs_platform_file_unmap(&map);
 
     if (!*t->desc.data) {
-        fclose(f);
         return false;
     }
 
@@ -8333,7 +12409,40 @@ gs_asset_texture_load_from_file(const char* path, void* out, gs_graphics_texture
         *t->desc.data = NULL;
     }
 
-    fclose(f);
+    return true;
+}
+
+GS_API_DECL bool 
+gs_asset_texture_reload(const char* path, void* out)
+{
+    gs_asset_texture_t* t = (gs_asset_texture_t*)out;
+
+    gs_platform_file_map_t map = gs_platform_file_map(path);
+    if (!map.data) {
+        return false;
+    }
+
+    int32_t comp = 0, width = 0, height = 0;
+    stbi_set_flip_vertically_on_load(t->desc.flip_y);
+    void* data = stbi_load_from_memory((const stbi_uc*)map.data, (int32_t)map.size, &width, &height, &comp, STBI_rgb_alpha);
+    gs_platform_file_unmap(&map);
+    if (!data) {
+        return false;
+    }
+
+    // Keep data around only if the original load did
+    void* prev = *t->desc.data;
+    t->desc.width = (uint32_t)width;
+    t->desc.height = (uint32_t)height;
+    *t->desc.data = data;
+    gs_graphics_texture_update(t->hndl, &t->desc);
+    if (prev) {
+        gs_free(prev);
+    } else {
+        gs_free(data);
+        *t->desc.data = NULL;
+    }
+
     return true;
 }
 
@@ -8386,19 +12495,18 @@ bool gs_asset_texture_load_from_memory(const void* memory, size_t sz, void* out,
 
 bool gs_asset_font_load_from_file(const char* path, void* out, uint32_t point_size)
 {
-    size_t len = 0;
-    char* ttf = gs_platform_read_file_contents(path, "rb", &len);
+    gs_platform_file_map_t map = gs_platform_file_map(path);
     if (!point_size) {
         gs_println("Warning: Font: %s: Point size not declared. Setting to default 16.", path);
         point_size = 16;
     }
-    bool ret = gs_asset_font_load_from_memory(ttf, len, out, point_size);
+    bool ret = gs_asset_font_load_from_memory(map.data, map.size, out, point_size);
     if (!ret) {
         gs_println("Font Failed to Load: %s", path);
     } else {
         gs_println("Font Successfully Loaded: %s", path);
     }
-    gs_free(ttf);
+    gs_platform_file_unmap(&map);
     return ret;
 }
 
@@ -8532,17 +12640,17 @@ bool gs_util_load_gltf_data_from_file(const char* path, gs_asset_mesh_decl_t* de
 {
     // Use cgltf like a boss
     cgltf_options options = gs_default_val();
-    size_t len = 0;
-    char* file_data = gs_platform_read_file_contents(path, "rb", &len);
+    gs_platform_file_map_t map = gs_platform_file_map(path);
     gs_println("Loading GLTF: %s", path);
 
+    // Parsed data references the view (glb binary chunk), so keep it mapped until cgltf_free()
     cgltf_data* data = NULL;
-    cgltf_result result = cgltf_parse(&options, file_data, (cgltf_size)len, &data);
-    gs_free(file_data);
+    cgltf_result result = cgltf_parse(&options, map.data, (cgltf_size)map.size, &data);
 
     if (result != cgltf_result_success) {
         gs_println("Mesh:LoadFromFile:Failed load gltf");
         cgltf_free(data);
+        gs_platform_file_unmap(&map);
         return false;
     }
 
@@ -8550,6 +12658,7 @@ bool gs_util_load_gltf_data_from_file(const char* path, gs_asset_mesh_decl_t* de
     result = cgltf_load_buffers(&options, data, path);
     if (result != cgltf_result_success) {
         cgltf_free(data);
+        gs_platform_file_unmap(&map);
         gs_println("Mesh:LoadFromFile:Failed to load buffers");
         return false;
     }
@@ -8811,6 +12920,7 @@ bool gs_util_load_gltf_data_from_file(const char* path, gs_asset_mesh_decl_t* de
 
     // Free all data at the end
     cgltf_free(data);
+    gs_platform_file_unmap(&map);
     gs_dyn_array_free(positions);
     gs_dyn_array_free(normals);
     gs_dyn_array_free(tangents);
@@ -8996,6 +13106,175 @@ GS_API_DECL bool gs_char_is_numeric(char c)
 
 //==== [ Lexer ] ============================================================//
 
+// Vectorized scanning for white space, comments and strings (define GS_LEXER_NO_SIMD to disable)
+#if (defined __SSE2__ || defined _M_X64 || defined _M_AMD64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)) && !defined GS_LEXER_NO_SIMD
+    #define GS_LEXER_SIMD_SSE2
+    #include <emmintrin.h>
+#endif
+
+#define GS_LEXER_CHAR_WHITE_SPACE   (1 << 0)
+#define GS_LEXER_CHAR_END_OF_LINE   (1 << 1)
+#define GS_LEXER_CHAR_ALPHA         (1 << 2)
+#define GS_LEXER_CHAR_NUMERIC       (1 << 3)
+#define GS_LEXER_CHAR_IDENTIFIER    (1 << 4)
+
+#define _GS_LWS (GS_LEXER_CHAR_WHITE_SPACE)
+#define _GS_LEL (GS_LEXER_CHAR_WHITE_SPACE | GS_LEXER_CHAR_END_OF_LINE)
+#define _GS_LAL (GS_LEXER_CHAR_ALPHA | GS_LEXER_CHAR_IDENTIFIER)
+#define _GS_LNM (GS_LEXER_CHAR_NUMERIC | GS_LEXER_CHAR_IDENTIFIER)
+#define _GS_LUS (GS_LEXER_CHAR_IDENTIFIER)
+
+// Character classification table, indexed by unsigned char
+gs_global const uint8_t gs_lexer_char_class[256] = 
+{
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       _GS_LWS, _GS_LEL, 0,       0,       _GS_LEL, 0,       0,       // 0x00
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       // 0x10
+    _GS_LWS, 0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       // 0x20
+    _GS_LNM, _GS_LNM, _GS_LNM, _GS_LNM, _GS_LNM, _GS_LNM, _GS_LNM, _GS_LNM, _GS_LNM, _GS_LNM, 0,       0,       0,       0,       0,       0,       // 0x30
+    0,       _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, // 0x40
+    _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, 0,       0,       0,       0,       _GS_LUS, // 0x50
+    0,       _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, // 0x60
+    _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, _GS_LAL, 0,       0,       0,       0,       0,       // 0x70
+    // 0x80 - 0xFF: 0
+};
+
+#undef _GS_LWS
+#undef _GS_LEL
+#undef _GS_LAL
+#undef _GS_LNM
+#undef _GS_LUS
+
+#define gs_lexer_char_is(C, CLS) (gs_lexer_char_class[(uint8_t)(C)] & (CLS))
+
+#ifdef GS_LEXER_SIMD_SSE2
+
+gs_force_inline uint32_t 
+_gs_lexer_ctz(uint32_t m)
+{
+#if (defined _MSC_VER && !defined __clang__)
+    unsigned long idx = 0;
+    _BitScanForward(&idx, m);
+    return (uint32_t)idx;
+#else
+    return (uint32_t)__builtin_ctz(m);
+#endif
+}
+
+gs_force_inline uint32_t 
+_gs_lexer_popcnt(uint32_t m)
+{
+    m = m - ((m >> 1) & 0x55555555);
+    m = (m & 0x33333333) + ((m >> 2) & 0x33333333);
+    return (((m + (m >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+}
+
+// Unaligned 16-byte loads are safe as long as they do not cross into the next (possibly unmapped) page
+#define _gs_lexer_simd_load_safe(AT) (((uintptr_t)(AT) & 4095) <= (4096 - 16))
+
+#endif
+
+// Returns first non white space character, counting end of line characters passed into 'line'
+gs_force_inline const char* 
+_gs_lexer_skip_white_space(const char* at, uint32_t* line)
+{
+#ifdef GS_LEXER_SIMD_SSE2
+    const __m128i sp = _mm_set1_epi8(' '), tb = _mm_set1_epi8('\t');
+    const __m128i nl = _mm_set1_epi8('\n'), cr = _mm_set1_epi8('\r');
+    while (gs_lexer_char_is(*at, GS_LEXER_CHAR_WHITE_SPACE))
+    {
+        if (!_gs_lexer_simd_load_safe(at)) {
+            if (gs_lexer_char_is(*at, GS_LEXER_CHAR_END_OF_LINE)) {(*line)++;}
+            at++;
+            continue;
+        }
+
+        __m128i v = _mm_loadu_si128((const __m128i*)at);
+        __m128i eol = _mm_or_si128(_mm_cmpeq_epi8(v, nl), _mm_cmpeq_epi8(v, cr));
+        __m128i ws = _mm_or_si128(eol, _mm_or_si128(_mm_cmpeq_epi8(v, sp), _mm_cmpeq_epi8(v, tb)));
+        uint32_t ws_mask = (uint32_t)_mm_movemask_epi8(ws);
+        uint32_t eol_mask = (uint32_t)_mm_movemask_epi8(eol);
+        if (ws_mask == 0xFFFF) {
+            *line += _gs_lexer_popcnt(eol_mask);
+            at += 16;
+            continue;
+        }
+        uint32_t n = _gs_lexer_ctz(~ws_mask);
+        *line += _gs_lexer_popcnt(eol_mask & ((1u << n) - 1));
+        return at + n;
+    }
+    return at;
+#else
+    while (gs_lexer_char_is(*at, GS_LEXER_CHAR_WHITE_SPACE)) {
+        if (gs_lexer_char_is(*at, GS_LEXER_CHAR_END_OF_LINE)) {(*line)++;}
+        at++;
+    }
+    return at;
+#endif
+}
+
+// Returns first occurrence of any of the given characters (pass '\0' to stop at the null terminator)
+gs_force_inline const char* 
+_gs_lexer_find_any(const char* at, char c0, char c1, char c2)
+{
+#ifdef GS_LEXER_SIMD_SSE2
+    const __m128i v0 = _mm_set1_epi8(c0), v1 = _mm_set1_epi8(c1), v2 = _mm_set1_epi8(c2);
+    for (;;)
+    {
+        if (!_gs_lexer_simd_load_safe(at)) {
+            if (*at == c0 || *at == c1 || *at == c2) return at;
+            at++;
+            continue;
+        }
+
+        __m128i v = _mm_loadu_si128((const __m128i*)at);
+        __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, v0), _mm_or_si128(_mm_cmpeq_epi8(v, v1), _mm_cmpeq_epi8(v, v2)));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(m);
+        if (mask) return at + _gs_lexer_ctz(mask);
+        at += 16;
+    }
+#else
+    while (*at != c0 && *at != c1 && *at != c2) at++;
+    return at;
+#endif
+}
+
+// Returns first character that can not continue an identifier ([A-Za-z0-9_])
+gs_force_inline const char* 
+_gs_lexer_skip_identifier(const char* at)
+{
+#ifdef GS_LEXER_SIMD_SSE2
+    const __m128i lo_a = _mm_set1_epi8('a' - 1), hi_z = _mm_set1_epi8('z' + 1);
+    const __m128i lo_0 = _mm_set1_epi8('0' - 1), hi_9 = _mm_set1_epi8('9' + 1);
+    const __m128i us = _mm_set1_epi8('_'), fold = _mm_set1_epi8(0x20);
+    while (_gs_lexer_simd_load_safe(at))
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)at);
+        __m128i l = _mm_or_si128(v, fold);
+        __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(l, lo_a), _mm_cmplt_epi8(l, hi_z));
+        __m128i num = _mm_and_si128(_mm_cmpgt_epi8(v, lo_0), _mm_cmplt_epi8(v, hi_9));
+        __m128i id = _mm_or_si128(_mm_or_si128(alpha, num), _mm_cmpeq_epi8(v, us));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(id);
+        if (mask != 0xFFFF) return at + _gs_lexer_ctz(~mask);
+        at += 16;
+    }
+#endif
+    while (gs_lexer_char_is(*at, GS_LEXER_CHAR_IDENTIFIER)) at++;
+    return at;
+}
+
+// Expects 'at' to be just past the opening '/*'. Returns position just past the closing '*/' (or the null terminator).
+gs_force_inline const char* 
+_gs_lexer_skip_multi_line_comment(const char* at)
+{
+    for (;;)
+    {
+        at = _gs_lexer_find_any(at, '*', '\0', '\0');
+        if (!at[0]) return at;
+        if (at[1] == '/') return at + 2;
+        at++;
+    }
+}
+
 GS_API_DECL void gs_lexer_set_contents(gs_lexer_t* lex, const char* contents)
 {
 	lex->at = contents;
@@ -9018,35 +13297,18 @@ GS_API_DECL void gs_lexer_c_eat_white_space(gs_lexer_t* lex)
 {
 	for (;;)
 	{
-        if (gs_char_is_white_space(*lex->at))
-		{
-            if (gs_char_is_end_of_line(*lex->at)) {lex->line++;}
-            lex->at++;
-		}
+        lex->at = _gs_lexer_skip_white_space(lex->at, &lex->line);
 
 		// Single line comment
-		else if ((lex->at[0] == '/') && (lex->at[1]) && (lex->at[1] == '/'))
+		if ((lex->at[0] == '/') && (lex->at[1] == '/'))
 		{
-			lex->at += 2;
-			while (*lex->at && !gs_char_is_end_of_line(*lex->at))
-			{
-				lex->at++;
-			}
+            lex->at = _gs_lexer_find_any(lex->at + 2, '\n', '\r', '\0');
 		}
 
 		// Multi-line comment
-		else if ((lex->at[0] == '/') && (lex->at[1]) && (lex->at[1] == '*'))
+		else if ((lex->at[0] == '/') && (lex->at[1] == '*'))
 		{
-			lex->at += 2;
-			while (lex->at[0] && lex->at[1] && !(lex->at[0] == '*' && lex->at[1] == '/'))
-			{
-                // if (gs_char_is_end_of_line(*lex->at)) {lex->line++;}
-				lex->at++;
-			}
-			if (lex->at[0] == '*')
-			{
-				lex->at++;
-			}
+            lex->at = _gs_lexer_skip_multi_line_comment(lex->at + 2);
 		}
 
 		else
@@ -9066,6 +13328,7 @@ gs_lexer_c_next_token(gs_lexer_t* lex)
 
 	gs_token_t t = gs_token_invalid_token();
 	t.text = lex->at;
+	t.type = GS_TOKEN_UNKNOWN;
 	t.len = 1;
 
 	if (lex->can_lex(lex)) 
@@ -9113,10 +13376,9 @@ gs_lexer_c_next_token(gs_lexer_t* lex)
                     lex->at++;
                     uint32_t num_decimals = 0;
                     while (
-                        lex->at[0] &&
-                        (gs_char_is_numeric(lex->at[0]) || 
+                        gs_lexer_char_is(lex->at[0], GS_LEXER_CHAR_NUMERIC) || 
                         (lex->at[0] == '.' && num_decimals == 0) || 
-                        lex->at[0] == 'f')
+                        lex->at[0] == 'f'
                     )
                     {
                         // Grab decimal
@@ -9137,11 +13399,7 @@ gs_lexer_c_next_token(gs_lexer_t* lex)
 				// Single line comment
 				if ((lex->at[0] == '/') && (lex->at[1]) && (lex->at[1] == '/'))
 				{
-					lex->at += 2;
-					while (lex->at[0] && !gs_char_is_end_of_line(lex->at[0]))
-					{
-						lex->at++;
-					}
+					lex->at = _gs_lexer_find_any(lex->at + 2, '\n', '\r', '\0');
 					t.len = lex->at - t.text;
 					t.type = GS_TOKEN_SINGLE_LINE_COMMENT;
 				}
@@ -9149,17 +13407,7 @@ gs_lexer_c_next_token(gs_lexer_t* lex)
 				// Multi line comment
 				else if ((lex->at[0] == '/') && (lex->at[1]) && (lex->at[1] == '*'))
 				{
-					lex->at += 2;
-					while (lex->can_lex(lex))
-					{
-                        // if (gs_char_is_end_of_line(*lex->at)) {lex->line++;}
-						if (lex->at[0] == '*' && lex->at[1] == '/')
-						{
-							lex->at += 2;
-							break;
-						}
-						lex->at++;
-					}
+					lex->at = _gs_lexer_skip_multi_line_comment(lex->at + 2);
 					t.len = lex->at - t.text;
 					t.type = GS_TOKEN_MULTI_LINE_COMMENT;
 				}
@@ -9176,18 +13424,19 @@ gs_lexer_c_next_token(gs_lexer_t* lex)
 				// Move forward after finding first quotation
 				lex->at++;
 
-				while (lex->at && *lex->at  != '"')
+				for (;;)
 				{
-                    // if (gs_char_is_end_of_line(*lex->at)) {lex->line++;}
+					lex->at = _gs_lexer_find_any(lex->at, '"', '\\', '\0');
 					if (lex->at[0] == '\\' && lex->at[1])
 					{
-						lex->at++;
+						lex->at += 2;
+						continue;
 					}
-					lex->at++;
+					break;
 				}
 
 				//Move past quotation
-				lex->at++;
+				if (*lex->at) lex->at++;
 				t.len = lex->at - t.text;
 				t.type = GS_TOKEN_STRING;
 			} break;
@@ -9195,25 +13444,18 @@ gs_lexer_c_next_token(gs_lexer_t* lex)
 			// Alpha/Numeric/Identifier
 			default: 
 			{
-				if ((gs_char_is_alpha(c) || c == '_') && c != '-')
+				if (gs_lexer_char_is(c, GS_LEXER_CHAR_ALPHA) || c == '_')
 				{
-					while (
-						gs_char_is_alpha(lex->at[0]) || 
-						gs_char_is_numeric(lex->at[0]) || 
-						lex->at[0] == '_'
-					)
-					{
-						lex->at++;
-					}
+					lex->at = _gs_lexer_skip_identifier(lex->at);
 
 					t.len = lex->at - t.text;
 					t.type = GS_TOKEN_IDENTIFIER;
 				}
-				else if (gs_char_is_numeric(c) && c != '-')
+				else if (gs_lexer_char_is(c, GS_LEXER_CHAR_NUMERIC))
 				{
 					uint32_t num_decimals = 0;
 					while (
-						gs_char_is_numeric(lex->at[0]) || 
+						gs_lexer_char_is(lex->at[0], GS_LEXER_CHAR_NUMERIC) || 
 						(lex->at[0] == '.' && num_decimals == 0) || 
 						lex->at[0] == 'f'
 					)
@@ -9238,6 +13480,9 @@ gs_lexer_c_next_token(gs_lexer_t* lex)
 		}
 	}
 
+	// Line the lexer is on after the token, same as buffered mode
+	t.line = lex->line;
+
 	// Set current token for lex
     lex->current_token = t;
     
@@ -9271,6 +13516,7 @@ GS_API_DECL gs_token_t gs_lexer_peek(gs_lexer_t* lex)
 {
 	// Store current at and current token
 	const char* at = lex->at;
+	uint32_t line = lex->line;
 	gs_token_t cur_t = gs_lexer_current_token(lex);
 
 	// Get next token
@@ -9279,6 +13525,7 @@ GS_API_DECL gs_token_t gs_lexer_peek(gs_lexer_t* lex)
 	// Reset
 	lex->current_token = cur_t;
 	lex->at = at;
+	lex->line = line;
 
 	// Return
 	return next_t;
@@ -9289,6 +13536,7 @@ GS_API_DECL bool gs_lexer_require_token_text(gs_lexer_t* lex, const char* match)
 {
 	// Store current position and token
 	const char* at = lex->at;
+	uint32_t line = lex->line;
 	gs_token_t cur_t = lex->current_token; 
 
 	// Get next token
@@ -9305,6 +13553,7 @@ GS_API_DECL bool gs_lexer_require_token_text(gs_lexer_t* lex, const char* match)
 
 	// Reset
 	lex->at = at;
+	lex->line = line;
 	lex->current_token = cur_t;
 
 	return false;
@@ -9314,6 +13563,7 @@ GS_API_DECL bool gs_lexer_require_token_type(gs_lexer_t* lex, gs_token_type type
 {
 	// Store current position and token
 	const char* at = lex->at;
+	uint32_t line = lex->line;
 	gs_token_t cur_t = lex->current_token;
 
 	// Get next token
@@ -9330,6 +13580,7 @@ GS_API_DECL bool gs_lexer_require_token_type(gs_lexer_t* lex, gs_token_type type
 
 	// Reset
 	lex->at = at;
+	lex->line = line;
 	lex->current_token = cur_t;
 
 	return false;
@@ -9366,6 +13617,86 @@ gs_lexer_advance_before_next_token_type(gs_lexer_t* lex, gs_token_type type)
 	return t;
 }
 
+GS_API_DECL void 
+gs_lexer_buffer_tokens(gs_lexer_t* lex)
+{
+    gs_lexer_buffer_free(lex);
+
+    // Lex everything remaining with the lexer's own functions
+    gs_lexer_t tmp = *lex;
+    while (tmp.can_lex(&tmp))
+    {
+        gs_token_t t = tmp.next_token(&tmp);
+        if (!t.text || !*t.text) break;
+        t.line = tmp.line;
+        gs_dyn_array_push(lex->tokens, t);
+    }
+
+    lex->token_idx = 0;
+    lex->can_lex = gs_lexer_buffered_can_lex;
+    lex->next_token = gs_lexer_buffered_next_token;
+}
+
+GS_API_DECL void 
+gs_lexer_buffer_free(gs_lexer_t* lex)
+{
+    if (lex->tokens) gs_dyn_array_free(lex->tokens);
+    lex->tokens = NULL;
+    lex->token_idx = 0;
+}
+
+// Peek/require restore 'at' directly, so resync the cursor to the first token at or past it
+gs_force_inline uint32_t
+_gs_lexer_buffered_sync(gs_lexer_t* lex)
+{
+    uint32_t cnt = gs_dyn_array_size(lex->tokens);
+    uint32_t idx = lex->token_idx;
+    if (
+        idx > cnt || 
+        (idx < cnt && lex->tokens[idx].text < lex->at) || 
+        (idx > 0 && lex->tokens[idx - 1].text >= lex->at)
+    )
+    {
+        uint32_t lo = 0, hi = cnt;
+        while (lo < hi) 
+        {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (lex->tokens[mid].text < lex->at) lo = mid + 1;
+            else hi = mid;
+        }
+        idx = lo;
+    }
+    lex->token_idx = idx;
+    return idx;
+}
+
+GS_API_DECL bool 
+gs_lexer_buffered_can_lex(gs_lexer_t* lex)
+{
+    return (_gs_lexer_buffered_sync(lex) < gs_dyn_array_size(lex->tokens));
+}
+
+GS_API_DECL gs_token_t 
+gs_lexer_buffered_next_token(gs_lexer_t* lex)
+{
+    uint32_t idx = _gs_lexer_buffered_sync(lex);
+    gs_token_t t = gs_token_invalid_token();
+    if (idx < gs_dyn_array_size(lex->tokens))
+    {
+        t = lex->tokens[idx];
+        lex->at = t.text + t.len;
+        lex->line = t.line;
+        lex->token_idx = idx + 1;
+    }
+    else
+    {
+        t.text = lex->at;
+    }
+    lex->current_token = t;
+    lex->size += t.len;
+    return t;
+}
+
 GS_API_DECL gs_lexer_t 
 gs_lexer_c_ctor(const char* contents)
 {
@@ -9392,6 +13723,16 @@ gs_default_main_window_close_callback(void* window);
 // Global instance of gunslinger framework (...THERE CAN ONLY BE ONE)
 gs_global gs_t* _gs_instance = gs_default_val();
 
+// Returns ms since *lap and restarts it
+gs_force_inline float 
+_gs_startup_lap(uint64_t* lap)
+{
+    const uint64_t now = _gs_os_time_ns();
+    const float ms = (float)(now - *lap) / 1000000.f;
+    *lap = now;
+    return ms;
+}
+
 GS_API_DECL gs_t* 
 gs_create(gs_app_desc_t app_desc)
 {
@@ -9406,9 +13747,15 @@ gs_create(gs_app_desc_t app_desc)
         if (app_desc.shutdown == NULL)          app_desc.shutdown = &gs_default_app_func;
         if (app_desc.init == NULL)              app_desc.init = &gs_default_app_func; 
 
+        uint64_t lap = _gs_os_time_ns();
+
         // Set up os api before all?
         gs_os_api_t os = gs_os_api_new();
 
+    #ifdef GS_PROFILE
+        gs_profile_set_thread_name("main");
+    #endif
+
         // Construct instance and set
         _gs_instance = (gs_t*)os.malloc(sizeof(gs_t));
         memset(_gs_instance, 0, sizeof(gs_t));
@@ -9420,6 +13767,8 @@ gs_create(gs_app_desc_t app_desc)
 
         // Set application description for framework
         gs_instance()->ctx.app = app_desc;
+        gs_startup_stats_t* startup = &gs_instance()->ctx.startup;
+        startup->begin = lap;
 
         // Set up function pointers
         gs_instance()->shutdown  = &gs_destroy;
@@ -9430,33 +13779,52 @@ gs_create(gs_app_desc_t app_desc)
         // Enable graphics API debugging
         gs_subsystem(platform)->settings.video.graphics.debug = app_desc.debug_gfx;
 
+        // Headless skips the native platform entirely, windows are virtual
+        gs_subsystem(platform)->headless.enabled = app_desc.headless.enabled;
+        gs_subsystem(platform)->headless.virtual_clock = app_desc.headless.enabled && app_desc.headless.virtual_clock;
+        gs_subsystem(platform)->time.epoch = gs_platform_elapsed_time_ns();
+
         // Default initialization for platform here
-        gs_platform_init(gs_subsystem(platform));
+        if (!app_desc.headless.enabled) {
+            gs_platform_init(gs_subsystem(platform));
+        }
+        startup->platform = _gs_startup_lap(&lap);
 
         // Set frame rate for application
         gs_subsystem(platform)->time.max_fps = app_desc.window.frame_rate;
+        gs_platform_set_frame_pacing(app_desc.frame_pacing);
+        gs_platform_set_idle(app_desc.idle);
 
         // Construct main window 
         gs_platform_window_create(&app_desc.window);
 
         // Set vsync for video
         gs_platform_enable_vsync(app_desc.window.vsync); 
+        startup->window = _gs_startup_lap(&lap);
 
         // Construct graphics api 
         gs_subsystem(graphics) = gs_graphics_create();
 
         // Initialize graphics here
         gs_graphics_init(gs_subsystem(graphics));
+        startup->graphics = _gs_startup_lap(&lap);
 
         // Construct audio api
         gs_subsystem(audio) = gs_audio_create();
 
-        // Initialize audio
+        // Initialize audio (device opens in the background)
         gs_audio_init(gs_subsystem(audio));
+        startup->audio = _gs_startup_lap(&lap);
 
         // Initialize application and set to running
         app_desc.init();
         gs_ctx()->app.is_running = true;
+        startup->app_init = _gs_startup_lap(&lap);
+
+        // Resources from init are created directly, afterwards the context moves to the render thread
+        if (app_desc.render_thread) {
+            gs_graphics_render_thread_start(gs_platform_main_window());
+        }
 
         // Set default callback for when main window close button is pressed
         gs_platform_set_window_close_callback(gs_platform_main_window(), &gs_default_main_window_close_callback);
@@ -9465,6 +13833,12 @@ gs_create(gs_app_desc_t app_desc)
     return gs_instance();
 }
 
+GS_API_DECL const gs_startup_stats_t* 
+gs_startup_stats()
+{
+    return &gs_ctx()->startup;
+}
+
 GS_API_DECL void 
 gs_set_instance(gs_t* gs)
 {
@@ -9493,66 +13867,136 @@ gs_app()
 GS_API_DECL void 
 gs_frame()
 {
-    // Remove these...
-    static uint32_t curr_ticks = 0; 
-    static uint32_t prev_ticks = 0;
-
     // Cache platform pointer
     gs_platform_t* platform = gs_subsystem(platform);
 
+    // Idle mode blocks here until something changes
+    gs_profile_scope("gs_platform_idle_wait") {
+        _gs_platform_idle_wait(platform);
+    }
+
+    gs_profile_begin("gs_frame");
+
     // Cache times at start of frame
-    platform->time.elapsed  = (float)gs_platform_elapsed_time();
-    platform->time.update   = platform->time.elapsed - platform->time.previous;
-    platform->time.previous = platform->time.elapsed;
+    platform->time.ticks          = gs_platform_ticks();
+    platform->time.update_ticks   = platform->time.ticks - platform->time.previous_ticks;
+    platform->time.previous_ticks = platform->time.ticks;
+    _gs_platform_time_sync(&platform->time);
+
+    // Injected events are processed along with this frame's native events
+    _gs_platform_flush_injected(platform);
 
     // Update platform and process input
-    gs_platform_update(platform);
+    gs_profile_scope("gs_platform_update") {
+        gs_platform_update(platform);
+    }
     if (!gs_instance()->ctx.app.is_running) {
+        gs_profile_end();
         gs_instance()->shutdown();
         return;
     }
 
+    // Record this frame's input, or replace it with the logged frame
+    _gs_platform_input_log_frame(platform);
+
+    // Deliver async file IO completions and file changes on the main thread
+    gs_profile_scope("gs_platform_io_dispatch") {
+        gs_platform_io_dispatch();
+        gs_platform_file_watch_update();
+    }
+
+    // Resume async tasks whose awaits completed
+    uint32_t tasks = 0;
+    gs_profile_scope("gs_async_update") {
+        tasks = gs_async_update();
+    }
+
+    // Fixed-timestep updates, render can interpolate with time.alpha
+    gs_app_desc_t* app = &gs_instance()->ctx.app;
+    if (app->fixed_update && app->fixed_timestep > 0.f)
+    {
+        gs_platform_frame_pacer_t* pacer = &platform->pacer;
+        uint32_t steps = 0;
+        pacer->accumulator += platform->time.delta;
+        gs_profile_scope("fixed_update") {
+            while (pacer->accumulator >= app->fixed_timestep && steps < GS_PLATFORM_FIXED_MAX_STEPS) {
+                app->fixed_update();
+                pacer->accumulator -= app->fixed_timestep;
+                steps++;
+            }
+        }
+        // Too far behind, drop the remaining time rather than spiral
+        if (pacer->accumulator >= app->fixed_timestep) {
+            pacer->accumulator = fmodf(pacer->accumulator, app->fixed_timestep);
+        }
+        platform->time.alpha = pacer->accumulator / app->fixed_timestep;
+        if (!app->is_running) {
+            gs_profile_end();
+            gs_instance()->shutdown();
+            return;
+        }
+    }
+
     // Process application context
-    gs_instance()->ctx.app.update();
+    gs_profile_scope("update") {
+        gs_instance()->ctx.app.update();
+    }
     if (!gs_instance()->ctx.app.is_running) {
+        gs_profile_end();
         gs_instance()->shutdown();
         return;
     }
 
+    // Input and live tasks keep idle mode drawing
+    _gs_platform_idle_update(platform, platform->events.tail != platform->events.head || tasks);
+
     // Clear all platform events
-    gs_dyn_array_clear(platform->events);
+    gs_platform_clear_events();
 
     // NOTE(John): This won't work forever. Must change eventually.
     // Swap all platform window buffers? Sure...
-    for 
-    (
-        gs_slot_array_iter it = 0;
-        gs_slot_array_iter_valid(platform->windows, it);
-        gs_slot_array_iter_advance(platform->windows, it)
-    )
+    gs_profile_begin("present");
+    if (gs_graphics_render_thread_active())
+    {
+        // Render thread executes this frame and swaps while the next one records
+        gs_graphics_render_thread_present();
+    }
+    else
     {
-        gs_platform_window_swap_buffer(it);
+        for 
+        (
+            gs_slot_array_iter it = 0;
+            gs_slot_array_iter_valid(platform->windows, it);
+            gs_slot_array_iter_advance(platform->windows, it)
+        )
+        {
+            gs_platform_window_swap_buffer(it);
+        }
     }
+    gs_profile_end();
 
     // Frame locking (not sure if this should be done here, but it is what it is)
-    platform->time.elapsed  = (float)gs_platform_elapsed_time();
-    platform->time.render   = platform->time.elapsed - platform->time.previous;
-    platform->time.previous = platform->time.elapsed;
-    platform->time.frame    = platform->time.update + platform->time.render;            // Total frame time
-    platform->time.delta    = platform->time.frame / 1000.f;
-
-    float target = (1000.f / platform->time.max_fps);
+    const uint64_t now            = gs_platform_ticks();
+    platform->time.render_ticks   = now - platform->time.previous_ticks;
+    platform->time.previous_ticks = now;
+    platform->time.frame_ticks    = platform->time.update_ticks + platform->time.render_ticks;   // Total frame time
+    _gs_platform_time_sync(&platform->time);
+
+    // Wait for the frame deadline, replaces frame/delta with the measured frame interval
+    gs_profile_scope("gs_platform_frame_pace") {
+        gs_platform_frame_pace();
+    }
 
-    if (platform->time.frame < target)
+    // Time to first frame
+    gs_startup_stats_t* startup = &gs_instance()->ctx.startup;
+    if (startup->first_frame == 0.f)
     {
-        gs_platform_sleep((float)(target - platform->time.frame));
-        
-        platform->time.elapsed = (float)gs_platform_elapsed_time();
-        double wait_time = platform->time.elapsed - platform->time.previous;
-        platform->time.previous = platform->time.elapsed;
-        platform->time.frame += wait_time;
-        platform->time.delta = platform->time.frame / 1000.f;
+        startup->first_frame = (float)(_gs_os_time_ns() - startup->begin) / 1000000.f;
+        gs_log_info("startup: %.2f ms to first frame (platform %.2f, window %.2f, graphics %.2f, audio %.2f, app init %.2f)", 
+            startup->first_frame, startup->platform, startup->window, startup->graphics, startup->audio, startup->app_init);
     }
+
+    gs_profile_end();
 }
 
 void gs_destroy()
@@ -9562,14 +14006,25 @@ void gs_destroy()
     gs_ctx()->app.is_running = false;
 
     // Shutdown subsystems
+    gs_graphics_render_thread_stop();
     gs_graphics_shutdown(gs_subsystem(graphics));
     gs_graphics_destroy(gs_subsystem(graphics));
 
     gs_audio_shutdown(gs_subsystem(audio));
     gs_audio_destroy(gs_subsystem(audio));
 
+    gs_async_shutdown();
+    gs_jobs_shutdown();
+    gs_platform_io_shutdown();
+    gs_platform_file_watch_shutdown();
+    gs_platform_input_record_end();
+    gs_platform_input_replay_end();
+
     gs_platform_shutdown(gs_subsystem(platform)); 
     gs_platform_destroy(gs_subsystem(platform));
+
+    // Flush and stop logger (no-op if never initialized)
+    gs_log_shutdown();
 }
 
 GS_API_DECL void 
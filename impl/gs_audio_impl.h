@@ -426,6 +426,9 @@ typedef struct miniaudio_data_t
     ma_device device;
     ma_device_config device_config;
     ma_mutex lock;
+    gs_thread_t device_thread;      // Opens the device off the main thread
+    bool32_t context_ready;
+    bool32_t device_ready;
 } miniaudio_data_t;
 
 void gs_audio_mutex_lock(gs_audio_t* audio)
@@ -453,6 +456,7 @@ void ma_audio_commit(ma_device* device, void* output, const void* input, ma_uint
     if (!audio->instances) 
         return;
 
+    gs_profile_begin("gs_audio_commit");
 
     // Call user commit function
     if (audio->commit)
@@ -564,29 +568,37 @@ void ma_audio_commit(ma_device* device, void* output, const void* input, ma_uint
     }
 
     gs_audio_mutex_unlock(audio);
+
+    gs_profile_end();
 }
 
 // Change this to fix sized audio instance buffer, then just use that internally.
 // The slot array isn't working across threads.
 // Or copy data over from one thread to another at a guaranteed sync point.
 
-gs_result gs_audio_init(gs_audio_t* audio)
+// Context creation and device probing can take hundreds of ms, so they run on their own thread. 
+// Instances can be created and played meanwhile, mixing starts once the device does.
+GS_API_PRIVATE void 
+_gs_audio_device_open(void* data)
 {
-    // Set user data of audio to be miniaudio data
-    audio->user_data = gs_malloc_init(miniaudio_data_t);
-    gs_slot_array_reserve(audio->instances, 1024);
+    gs_audio_t* audio = (gs_audio_t*)data;
     miniaudio_data_t* output = (miniaudio_data_t*)audio->user_data;
+    const uint64_t start = _gs_os_time_ns();
 
     ma_result result = gs_default_val();
 
      // Init audio context
     ma_context_config ctx_config = ma_context_config_init();
 
-    result = ma_context_init(NULL, 0, &ctx_config, &output->context);
+    // Headless mixes into miniaudio's null device, so the audio api keeps working
+    ma_backend null_backend = ma_backend_null;
+    const bool32_t headless = gs_platform_headless();
+    result = ma_context_init(headless ? &null_backend : NULL, headless ? 1 : 0, &ctx_config, &output->context);
     if (result != MA_SUCCESS) {
-        gs_assert(false);
-        return GS_RESULT_FAILURE;
+        gs_log_warning("Unable to initialize audio context");
+        return;
     }
+    output->context_ready = true;
 
       // Init audio device
     // NOTE: Using the default device. Format is floating point because it simplifies mixing.
@@ -623,15 +635,34 @@ gs_result gs_audio_init(gs_audio_t* audio)
 
     if ((ma_device_init(NULL, &output->device_config, &output->device)) != MA_SUCCESS) {
         gs_assert(false);
+        return;
     }
+    output->device_ready = true;
 
     if ((ma_device_start(&output->device)) != MA_SUCCESS) {
         gs_assert(false);
     }
 
-    // Initialize the mutex, ya dummy
+    gs_ctx()->startup.audio_device = (float)(_gs_os_time_ns() - start) / 1000000.f;
+}
+
+gs_result gs_audio_init(gs_audio_t* audio)
+{
+    // Set user data of audio to be miniaudio data
+    audio->user_data = gs_malloc_init(miniaudio_data_t);
+    gs_slot_array_reserve(audio->instances, 1024);
+    miniaudio_data_t* output = (miniaudio_data_t*)audio->user_data;
+
+    // Initialize the mutex before the device can call back, ya dummy
     if (ma_mutex_init(&output->lock) != MA_SUCCESS) {
         gs_assert(false);
+        return GS_RESULT_FAILURE;
+    }
+
+    // No thread support, open the device in place
+    output->device_thread = gs_thread_create(_gs_audio_device_open, audio);
+    if (!output->device_thread.valid) {
+        _gs_audio_device_open(audio);
     }
 
     return GS_RESULT_SUCCESS;
@@ -648,8 +679,11 @@ gs_result gs_audio_shutdown(gs_audio_t* audio)
 {
     miniaudio_data_t* ma = (miniaudio_data_t*)audio->user_data; 
 
-    ma_context_uninit(&ma->context);
-    ma_device_uninit(&ma->device);
+    // Device may still be opening
+    gs_thread_join(&ma->device_thread);
+
+    if (ma->device_ready) ma_device_uninit(&ma->device);
+    if (ma->context_ready) ma_context_uninit(&ma->context);
     ma_mutex_uninit(&ma->lock);
     
     return GS_RESULT_SUCCESS;
@@ -48,9 +48,7 @@ typedef enum gsgl_uniform_type
 typedef struct gsgl_uniform_t {
     char name[64];               // Name of uniform to find location
     gsgl_uniform_type type;         // Type of uniform data
-    uint32_t location;              // Location of uniform
     size_t size;                    // Total data size of uniform
-    uint32_t sid;                   // Shader id (should probably inverse this, but I don't want to force a map lookup)
     uint32_t count;                 // Count (used for arrays)
 } gsgl_uniform_t;
 
@@ -67,6 +65,9 @@ typedef struct gsgl_uniform_buffer_t {
     size_t size;
     uint32_t ubo;
     uint32_t sid;
+    bool32_t stream;            // Latest data lives in the streaming ring
+    size_t stream_offset;
+    size_t data_size;           // Bytes of the latest data, bound when no range is given. size is the ubo's own allocation.
 } gsgl_uniform_buffer_t;
 
 typedef struct gsgl_storage_buffer_t {
@@ -81,6 +82,13 @@ typedef struct gsgl_storage_buffer_t {
 } gsgl_storage_buffer_t;
 
 /* Pipeline */
+// Where a uniform list's field locations live in a pipeline's binding table
+typedef struct gsgl_uniform_binding_t {
+    uint32_t offset;                // Into uniform_locations
+    uint32_t count;                 // Locations reserved at offset
+    bool32_t resolved;
+} gsgl_uniform_binding_t;
+
 typedef struct gsgl_pipeline_t {
     gs_graphics_blend_state_desc_t blend;
     gs_graphics_depth_state_desc_t depth;
@@ -88,6 +96,8 @@ typedef struct gsgl_pipeline_t {
     gs_graphics_stencil_state_desc_t stencil;
     gs_graphics_compute_state_desc_t compute;
     gs_dyn_array(gs_graphics_vertex_attribute_desc_t) layout;
+    gs_dyn_array(gsgl_uniform_binding_t) uniform_table;     // Indexed by uniform handle id
+    gs_dyn_array(int32_t) uniform_locations;                // Field locations in the pipeline's shader, -1 if not found
 } gsgl_pipeline_t;
 
 /* Render Pass */
@@ -111,6 +121,7 @@ typedef struct gsgl_texture_t {
 } gsgl_texture_t;
 
 typedef struct gsgl_vertex_buffer_decl_t {
+    uint32_t id;
     gsgl_buffer_t vbo;
     gs_graphics_vertex_data_type data_type;
     size_t offset;
@@ -126,6 +137,107 @@ typedef struct gsgl_data_cache_t
     gs_handle(gs_graphics_pipeline_t) pipeline;
 } gsgl_data_cache_t;
 
+/* Vertex array objects, cached by pipeline layout, bound vertex buffers and index buffer */
+#ifndef GSGL_VAO_CACHE_MAX
+    #define GSGL_VAO_CACHE_MAX 1024     // Cache is flushed once it holds this many
+#endif
+
+typedef struct gsgl_vao_t
+{
+    uint32_t id;
+    bool32_t instanced;             // Layout has a divisor
+    gs_dyn_array(uint32_t) key;     // Full key, hashes are only used to find it
+} gsgl_vao_t;
+
+/* Streaming ring, stream usage updates from command buffers sub-allocate from one persistently mapped buffer */
+#ifndef GSGL_STREAM_RING_SIZE
+    #define GSGL_STREAM_RING_SIZE (16 * 1024 * 1024)    // Bytes, 0 disables the ring
+#endif
+
+typedef struct gsgl_stream_region_t
+{
+    GLsync sync;
+    size_t size;                    // Bytes freed once the fence signals
+} gsgl_stream_region_t;
+
+typedef struct gsgl_stream_alloc_t
+{
+    size_t offset;
+    size_t size;
+    size_t capacity;                // Bytes in the buffer's own storage, only grows. 0 if unknown.
+    bool32_t active;                // Buffer's latest data lives in the ring at offset
+} gsgl_stream_alloc_t;
+
+typedef struct gsgl_stream_live_t
+{
+    gs_graphics_buffer_type type;
+    uint32_t id;
+} gsgl_stream_live_t;
+
+typedef struct gsgl_stream_ring_t
+{
+    uint32_t buffer;                // 0 if unavailable (needs GL 4.4)
+    uint8_t* map;
+    size_t size;
+    size_t head;
+    size_t used;                    // Bytes in flight, including padding skipped at wrap
+    size_t pending;                 // Bytes written since the last fence
+    size_t ubo_align;
+    uint32_t retired;               // Regions before this index have signaled
+    gs_dyn_array(gsgl_stream_region_t) regions;
+    gs_dyn_array(gsgl_stream_alloc_t) vbos;     // Indexed by vertex buffer id
+    gs_dyn_array(gsgl_stream_alloc_t) ibos;     // Indexed by index buffer id
+    gs_dyn_array(gsgl_stream_live_t) live;      // Buffers streamed this submit, copied back when it ends
+} gsgl_stream_ring_t;
+
+/* Shadowed GL state, calls only reach the driver when the value changes */
+typedef enum gsgl_state_type
+{
+    GSGL_STATE_DEPTH_TEST = 0x00,   // Capabilities first, indexes gsgl_state_caps
+    GSGL_STATE_STENCIL_TEST,
+    GSGL_STATE_BLEND,
+    GSGL_STATE_CULL_FACE,
+    GSGL_STATE_SCISSOR_TEST,
+    GSGL_STATE_MULTISAMPLE,
+    GSGL_STATE_CAP_COUNT,
+    GSGL_STATE_DEPTH_FUNC = GSGL_STATE_CAP_COUNT,
+    GSGL_STATE_DEPTH_MASK,
+    GSGL_STATE_STENCIL_FUNC,
+    GSGL_STATE_STENCIL_MASK,
+    GSGL_STATE_STENCIL_OP,
+    GSGL_STATE_BLEND_EQUATION,
+    GSGL_STATE_BLEND_FUNC,
+    GSGL_STATE_CULL_MODE,
+    GSGL_STATE_FRONT_FACE,
+    GSGL_STATE_PROGRAM,
+    GSGL_STATE_VIEWPORT,
+    GSGL_STATE_SCISSOR,
+    GSGL_STATE_VAO,
+    GSGL_STATE_INDIRECT_BUFFER,
+    GSGL_STATE_COUNT
+} gsgl_state_type;
+
+typedef struct gsgl_state_cache_t
+{
+    uint32_t known;                 // Bit per gsgl_state_type, cleared entries are always emitted
+    bool32_t caps[GSGL_STATE_CAP_COUNT];
+    uint32_t depth_func;
+    uint32_t depth_mask;
+    uint32_t stencil_func[3];       // func, ref, mask
+    uint32_t stencil_mask;
+    uint32_t stencil_op[3];         // sfail, dpfail, dppass
+    uint32_t blend_equation;
+    uint32_t blend_func[2];         // src, dst
+    uint32_t cull_mode;
+    uint32_t front_face;
+    uint32_t program;
+    uint32_t viewport[4];
+    uint32_t scissor[4];
+    uint32_t vao;
+    uint32_t indirect_buffer;
+    gs_graphics_state_stats_t stats;
+} gsgl_state_cache_t;
+
 /* Internal Opengl Data */
 typedef struct gsgl_data_t
 {
@@ -154,6 +266,16 @@ typedef struct gsgl_data_t
     // Cached data between draw calls (to minimize state changes)
     gsgl_data_cache_t cache;
 
+    // Fixed function state and program last sent to the driver
+    gsgl_state_cache_t state;
+
+    // Vertex array objects by binding set
+    gs_hash_table(uint64_t, gsgl_vao_t) vaos;
+    gs_dyn_array(uint32_t) vao_key;     // Scratch for building keys
+
+    // Streamed vertex, index and uniform data
+    gsgl_stream_ring_t stream;
+
 } gsgl_data_t;
 
 /* Internal OGL Command Buffer Op Code */
@@ -170,6 +292,7 @@ typedef enum gs_opengl_op_code_type
     GS_OPENGL_OP_APPLY_BINDINGS,
     GS_OPENGL_OP_DISPATCH_COMPUTE,
     GS_OPENGL_OP_DRAW,
+    GS_OPENGL_OP_DRAW_INDIRECT,
 } gs_opengl_op_code_type;
 
 void gsgl_reset_data_cache(gsgl_data_cache_t* cache)
@@ -180,22 +303,175 @@ void gsgl_reset_data_cache(gsgl_data_cache_t* cache)
     gs_dyn_array_clear(cache->vdecls);
 }
 
+gsgl_state_cache_t* gsgl_state()
+{
+    return &((gsgl_data_t*)gs_subsystem(graphics)->user_data)->state;
+}
+
+// Returns whether the call has to be made, and records the new value as sent
+gs_force_inline bool32_t 
+gsgl_state_changed(gsgl_state_cache_t* s, gsgl_state_type type, bool32_t equal)
+{
+    const uint32_t bit = 1u << (uint32_t)type;
+    if ((s->known & bit) && equal) {
+        s->stats.skipped++;
+        return false;
+    }
+    s->known |= bit;
+    s->stats.emitted++;
+    return true;
+}
+
+void gsgl_state_invalidate(gsgl_state_cache_t* s)
+{
+    s->known = 0;
+}
+
+void gsgl_state_enable(gsgl_state_type cap, bool32_t enabled)
+{
+    static const uint32_t gl_caps[GSGL_STATE_CAP_COUNT] = {
+        GL_DEPTH_TEST, GL_STENCIL_TEST, GL_BLEND, GL_CULL_FACE, GL_SCISSOR_TEST, GL_MULTISAMPLE
+    };
+    gsgl_state_cache_t* s = gsgl_state();
+    enabled = enabled ? true : false;
+    if (!gsgl_state_changed(s, cap, s->caps[cap] == enabled)) return;
+    s->caps[cap] = enabled;
+    if (enabled) glEnable(gl_caps[cap]);
+    else glDisable(gl_caps[cap]);
+}
+
+void gsgl_state_depth_func(uint32_t func)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_DEPTH_FUNC, s->depth_func == func)) return;
+    s->depth_func = func;
+    glDepthFunc(func);
+}
+
+void gsgl_state_depth_mask(uint32_t mask)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_DEPTH_MASK, s->depth_mask == mask)) return;
+    s->depth_mask = mask;
+    glDepthMask(mask);
+}
+
+void gsgl_state_stencil_func(uint32_t func, uint32_t ref, uint32_t mask)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    const uint32_t v[3] = {func, ref, mask};
+    if (!gsgl_state_changed(s, GSGL_STATE_STENCIL_FUNC, memcmp(s->stencil_func, v, sizeof(v)) == 0)) return;
+    memcpy(s->stencil_func, v, sizeof(v));
+    glStencilFunc(func, ref, mask);
+}
+
+void gsgl_state_stencil_mask(uint32_t mask)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_STENCIL_MASK, s->stencil_mask == mask)) return;
+    s->stencil_mask = mask;
+    glStencilMask(mask);
+}
+
+void gsgl_state_stencil_op(uint32_t sfail, uint32_t dpfail, uint32_t dppass)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    const uint32_t v[3] = {sfail, dpfail, dppass};
+    if (!gsgl_state_changed(s, GSGL_STATE_STENCIL_OP, memcmp(s->stencil_op, v, sizeof(v)) == 0)) return;
+    memcpy(s->stencil_op, v, sizeof(v));
+    glStencilOp(sfail, dpfail, dppass);
+}
+
+void gsgl_state_blend_equation(uint32_t eq)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_BLEND_EQUATION, s->blend_equation == eq)) return;
+    s->blend_equation = eq;
+    glBlendEquation(eq);
+}
+
+void gsgl_state_blend_func(uint32_t src, uint32_t dst)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_BLEND_FUNC, s->blend_func[0] == src && s->blend_func[1] == dst)) return;
+    s->blend_func[0] = src;
+    s->blend_func[1] = dst;
+    glBlendFunc(src, dst);
+}
+
+void gsgl_state_cull_face(uint32_t mode)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_CULL_MODE, s->cull_mode == mode)) return;
+    s->cull_mode = mode;
+    glCullFace(mode);
+}
+
+void gsgl_state_front_face(uint32_t mode)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_FRONT_FACE, s->front_face == mode)) return;
+    s->front_face = mode;
+    glFrontFace(mode);
+}
+
+void gsgl_state_program(uint32_t program)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_PROGRAM, s->program == program)) return;
+    s->program = program;
+    glUseProgram(program);
+}
+
+void gsgl_state_viewport(uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    const uint32_t v[4] = {x, y, w, h};
+    if (!gsgl_state_changed(s, GSGL_STATE_VIEWPORT, memcmp(s->viewport, v, sizeof(v)) == 0)) return;
+    memcpy(s->viewport, v, sizeof(v));
+    glViewport(x, y, w, h);
+}
+
+void gsgl_state_scissor(uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    const uint32_t v[4] = {x, y, w, h};
+    if (!gsgl_state_changed(s, GSGL_STATE_SCISSOR, memcmp(s->scissor, v, sizeof(v)) == 0)) return;
+    memcpy(s->scissor, v, sizeof(v));
+    glScissor(x, y, w, h);
+}
+
+void gsgl_state_vao(uint32_t vao)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_VAO, s->vao == vao)) return;
+    s->vao = vao;
+    glBindVertexArray(vao);
+}
+
+void gsgl_state_indirect_buffer(uint32_t buffer)
+{
+    gsgl_state_cache_t* s = gsgl_state();
+    if (!gsgl_state_changed(s, GSGL_STATE_INDIRECT_BUFFER, s->indirect_buffer == buffer)) return;
+    s->indirect_buffer = buffer;
+    CHECK_GL_CORE(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer);)
+}
+
+// Element array binding is vao state, so index buffer uploads go through the default vao
+void gsgl_state_vao_default()
+{
+    gsgl_state_vao(((gsgl_data_t*)gs_subsystem(graphics)->user_data)->cache.vao);
+}
+
 void gsgl_pipeline_state()
 {
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     glBindTexture(GL_TEXTURE_2D, 0);
     glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
     CHECK_GL_CORE(
         glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
     )
-    glDisable(GL_DEPTH_TEST);
-    glDisable(GL_STENCIL_TEST);
-    glDisable(GL_BLEND);
-    CHECK_GL_CORE(
-        glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
-    );
-    glDisable(GL_MULTISAMPLE);
+    gsgl_state_enable(GSGL_STATE_MULTISAMPLE, false);
 
     CHECK_GL_CORE(
         gs_graphics_info_t* info = gs_graphics_info();
@@ -557,6 +833,425 @@ size_t gsgl_get_vertex_attr_byte_offest(gs_dyn_array(gs_graphics_vertex_attribut
     return total_offset;
 }
 
+/* Streaming ring */
+void gsgl_stream_init(gsgl_data_t* ogl)
+{
+    gsgl_stream_ring_t* r = &ogl->stream;
+    CHECK_GL_CORE(
+        if (!GSGL_STREAM_RING_SIZE || !GLAD_GL_VERSION_4_4) return;
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glGenBuffers(1, &r->buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, r->buffer);
+        glBufferStorage(GL_COPY_WRITE_BUFFER, GSGL_STREAM_RING_SIZE, NULL, flags);
+        r->map = (uint8_t*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, GSGL_STREAM_RING_SIZE, flags);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        if (!r->map) {
+            gs_println("Warning: Graphics: Stream ring unavailable, falling back to buffer uploads.");
+            glDeleteBuffers(1, &r->buffer);
+            r->buffer = 0;
+            return;
+        }
+
+        GLint align = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align);
+        r->ubo_align = gs_max(align, 16);
+        r->size = GSGL_STREAM_RING_SIZE;
+    );
+}
+
+void gsgl_stream_fence(gsgl_stream_ring_t* r);
+
+// Frees the oldest region in flight. With wait, blocks until it signals, fencing pending writes first if needed.
+bool gsgl_stream_retire(gsgl_stream_ring_t* r, bool wait)
+{
+    if (r->retired == gs_dyn_array_size(r->regions)) {
+        if (!wait || !r->pending) return false;
+        gsgl_stream_fence(r);
+
+        // Fencing polls, which may have freed it already
+        if (r->retired == gs_dyn_array_size(r->regions)) return true;
+    }
+
+    gsgl_stream_region_t* g = &r->regions[r->retired];
+    GLenum res = glClientWaitSync(g->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    while (wait && res == GL_TIMEOUT_EXPIRED) {
+        res = glClientWaitSync(g->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    }
+    if (res == GL_TIMEOUT_EXPIRED) return false;
+
+    glDeleteSync(g->sync);
+    r->used -= g->size;
+    if (++r->retired == gs_dyn_array_size(r->regions)) {
+        gs_dyn_array_clear(r->regions);
+        r->retired = 0;
+    }
+    return true;
+}
+
+// Closes the region written since the last fence, called once commands reading it are issued
+void gsgl_stream_fence(gsgl_stream_ring_t* r)
+{
+    if (!r->pending) return;
+    gsgl_stream_region_t g = gs_default_val();
+    g.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    g.size = r->pending;
+    gs_dyn_array_push(r->regions, g);
+    r->pending = 0;
+
+    // Reclaim whatever the GPU is already done with
+    while (gsgl_stream_retire(r, false));
+}
+
+// Copies data into the ring, returns false when the caller should upload to the buffer itself
+bool gsgl_stream_write(gsgl_stream_ring_t* r, const void* data, size_t sz, size_t align, size_t* out)
+{
+    // Large uploads would stall on the whole ring
+    if (!r->buffer || !sz || sz > r->size / 4) return false;
+
+    size_t pos = (r->head + align - 1) / align * align;
+    if (pos + sz > r->size) pos = 0;
+    const size_t need = (pos >= r->head ? pos - r->head : r->size - r->head) + sz;
+
+    while (r->used + need > r->size) {
+        if (!gsgl_stream_retire(r, true)) return false;
+    }
+
+    memcpy(r->map + pos, data, sz);
+    r->head = pos + sz;
+    r->used += need;
+    r->pending += need;
+    *out = pos;
+    return true;
+}
+
+gsgl_stream_alloc_t* gsgl_stream_slot(gs_dyn_array(gsgl_stream_alloc_t)* table, uint32_t id)
+{
+    while (gs_dyn_array_size(*table) <= id) {
+        gsgl_stream_alloc_t a = gs_default_val();
+        gs_dyn_array_push(*table, a);
+    }
+    return &(*table)[id];
+}
+
+// Buffer's own storage holds its data again
+void gsgl_stream_release(gs_dyn_array(gsgl_stream_alloc_t) table, uint32_t id)
+{
+    if (id < gs_dyn_array_size(table)) {
+        table[id].active = false;
+        table[id].capacity = 0;
+    }
+}
+
+// Copies sz bytes at offset in the ring to the start of buffer. Storage only grows, so varying upload sizes don't reallocate.
+// Returns the buffer's capacity afterwards.
+size_t gsgl_stream_copy_back(gsgl_stream_ring_t* r, uint32_t buffer, size_t offset, size_t sz, size_t capacity)
+{
+    glBindBuffer(GL_COPY_READ_BUFFER, r->buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    if (sz > capacity) {
+        glBufferData(GL_COPY_WRITE_BUFFER, sz, NULL, GL_STREAM_DRAW);
+        capacity = sz;
+    }
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, 0, sz);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    return capacity;
+}
+
+// Moves a buffer's streamed data back into its own storage. The copy is queued before the ring region's fence, 
+// so the region can't be reused until it has landed.
+void gsgl_stream_resolve(gsgl_data_t* ogl, gs_graphics_buffer_type type, uint32_t id)
+{
+    gsgl_stream_ring_t* r = &ogl->stream;
+    switch (type)
+    {
+        case GS_GRAPHICS_BUFFER_VERTEX:
+        case GS_GRAPHICS_BUFFER_INDEX:
+        {
+            const bool vertex = type == GS_GRAPHICS_BUFFER_VERTEX;
+            gs_dyn_array(gsgl_stream_alloc_t) t = vertex ? r->vbos : r->ibos;
+            if (id >= gs_dyn_array_size(t) || !t[id].active) return;
+            gsgl_stream_alloc_t* a = &t[id];
+            const gsgl_buffer_t buffer = vertex ? gs_slot_array_get(ogl->vertex_buffers, id) : gs_slot_array_get(ogl->index_buffers, id);
+            a->capacity = gsgl_stream_copy_back(r, buffer, a->offset, a->size, a->capacity);
+            a->active = false;
+        } break;
+
+        case GS_GRAPHICS_BUFFER_UNIFORM:
+        {
+            if (!gs_slot_array_exists(ogl->uniform_buffers, id)) return;
+            gsgl_uniform_buffer_t* u = gs_slot_array_getp(ogl->uniform_buffers, id);
+            if (!u->stream) return;
+            u->size = gsgl_stream_copy_back(r, u->ubo, u->stream_offset, u->data_size, u->size);
+            u->stream = false;
+        } break;
+
+        default: break;
+    }
+}
+
+// Ring data only lives as long as the submit that wrote it, later submits read the buffers' own storage
+void gsgl_stream_resolve_live(gsgl_data_t* ogl)
+{
+    gsgl_stream_ring_t* r = &ogl->stream;
+    for (uint32_t i = 0; i < gs_dyn_array_size(r->live); ++i) {
+        gsgl_stream_resolve(ogl, r->live[i].type, r->live[i].id);
+    }
+    gs_dyn_array_clear(r->live);
+}
+
+void gsgl_stream_track(gsgl_stream_ring_t* r, gs_graphics_buffer_type type, uint32_t id)
+{
+    gsgl_stream_live_t l = {type, id};
+    gs_dyn_array_push(r->live, l);
+}
+
+// GL buffer and byte offset currently holding a vertex/index buffer's data
+gsgl_buffer_t gsgl_stream_vbo(gsgl_data_t* ogl, const gsgl_vertex_buffer_decl_t* vdecl, size_t* base)
+{
+    const gs_dyn_array(gsgl_stream_alloc_t) t = ogl->stream.vbos;
+    const bool streamed = vdecl->id < gs_dyn_array_size(t) && t[vdecl->id].active;
+    *base = streamed ? t[vdecl->id].offset : 0;
+    return streamed ? ogl->stream.buffer : vdecl->vbo;
+}
+
+gsgl_buffer_t gsgl_stream_ibo(gsgl_data_t* ogl, size_t* base)
+{
+    const uint32_t id = ogl->cache.ibo;
+    const gs_dyn_array(gsgl_stream_alloc_t) t = ogl->stream.ibos;
+    *base = 0;
+    if (!id) return 0;
+    if (id < gs_dyn_array_size(t) && t[id].active) {
+        *base = t[id].offset;
+        return ogl->stream.buffer;
+    }
+    return gs_slot_array_get(ogl->index_buffers, id);
+}
+
+void gsgl_stream_shutdown(gsgl_data_t* ogl)
+{
+    gsgl_stream_ring_t* r = &ogl->stream;
+    for (uint32_t i = r->retired; i < gs_dyn_array_size(r->regions); ++i) {
+        glDeleteSync(r->regions[i].sync);
+    }
+    if (r->buffer) glDeleteBuffers(1, &r->buffer);      // Unmaps
+    gs_dyn_array_free(r->regions);
+    gs_dyn_array_free(r->vbos);
+    gs_dyn_array_free(r->ibos);
+    gs_dyn_array_free(r->live);
+    memset(r, 0, sizeof(*r));
+}
+
+/* Uniform binding table */
+
+// Looks up the field locations of uniform list `uid` in the pipeline's shader.
+// Names are only resolved the first time a pipeline sees a list. Returns NULL if the shader doesn't exist.
+int32_t* gsgl_pipeline_uniform_locations(gsgl_data_t* ogl, gsgl_pipeline_t* pip, uint32_t uid)
+{
+    while (gs_dyn_array_size(pip->uniform_table) <= uid) {
+        gsgl_uniform_binding_t b = gs_default_val();
+        gs_dyn_array_push(pip->uniform_table, b);
+    }
+
+    gsgl_uniform_binding_t* b = &pip->uniform_table[uid];
+    if (b->resolved) {
+        return pip->uniform_locations + b->offset;
+    }
+
+    // Get bound shader from pipeline (either compute or raster)
+    uint32_t sid = pip->compute.shader.id ? pip->compute.shader.id : pip->raster.shader.id;
+    if (!sid || !gs_slot_array_exists(ogl->shaders, sid) || !gs_slot_array_exists(ogl->uniforms, uid)) {
+        return NULL;
+    }
+
+    gsgl_shader_t shader = gs_slot_array_get(ogl->shaders, sid);
+    gsgl_uniform_list_t* ul = gs_slot_array_getp(ogl->uniforms, uid);
+    const uint32_t ct = gs_dyn_array_size(ul->uniforms);
+
+    // Reserve space, reusing the previous slot if the id was recycled
+    if (ct > b->count) {
+        b->offset = gs_dyn_array_size(pip->uniform_locations);
+        b->count = ct;
+        for (uint32_t i = 0; i < ct; ++i) {
+            gs_dyn_array_push(pip->uniform_locations, -1);
+        }
+    }
+
+    for (uint32_t i = 0; i < ct; ++i)
+    {
+        // Construct temp name, concat with base name + uniform field name
+        char name[256] = gs_default_val();
+        gs_snprintf(name, sizeof(name), "%s%s", ul->name, ul->uniforms[i].name);
+
+        // Grab location of uniform based on name
+        int32_t location = glGetUniformLocation(shader, *name ? name : "__EMPTY_UNIFORM_NAME");
+        if (location < 0) {
+            gs_println("Warning: Bind Uniform: Uniform not found: \"%s\"", name);
+        }
+        pip->uniform_locations[b->offset + i] = location;
+    }
+
+    b->resolved = true;
+    return pip->uniform_locations + b->offset;
+}
+
+/* Vertex array cache */
+void gsgl_vao_cache_flush(gsgl_data_t* ogl)
+{
+    if (!gs_hash_table_size(ogl->vaos)) return;
+    for (
+        gs_hash_table_iter it = gs_hash_table_iter_new(ogl->vaos);
+        gs_hash_table_iter_valid(ogl->vaos, it);
+        gs_hash_table_iter_advance(ogl->vaos, it)
+    )
+    {
+        gsgl_vao_t* vao = gs_hash_table_iter_getp(ogl->vaos, it);
+        glDeleteVertexArrays(1, &vao->id);
+        gs_dyn_array_free(vao->key);
+    }
+    gs_hash_table_clear(ogl->vaos);
+
+    // Deleting the bound vao reverts to 0
+    gsgl_state_vao_default();
+}
+
+// Buffer, stride and byte offset sourcing attribute i
+gsgl_buffer_t gsgl_vao_attrib(gsgl_data_t* ogl, gsgl_pipeline_t* pip, uint32_t i, size_t* stride, size_t* offset)
+{
+    // Vertex buffer to bind
+    uint32_t vbo_idx = i; //pip->layout[i].buffer_idx;
+    const gsgl_vertex_buffer_decl_t* vdecl = vbo_idx < gs_dyn_array_size(ogl->cache.vdecls) ? &ogl->cache.vdecls[vbo_idx] : &ogl->cache.vdecls[0];
+    size_t base = 0;
+    gsgl_buffer_t vbo = gsgl_stream_vbo(ogl, vdecl, &base);
+
+    // Manual override. If you manually set divisor/stride/offset, then will not automatically calculate any of those.
+    bool is_manual = pip->layout[i].stride | pip->layout[i].divisor | pip->layout[i].offset | (vdecl->data_type == GS_GRAPHICS_VERTEX_DATA_NONINTERLEAVED);
+
+    // Stride of vertex attribute
+    *stride = is_manual ? pip->layout[i].stride : 
+                    gsgl_calculate_vertex_size_in_bytes(pip->layout, gs_dyn_array_size(pip->layout));
+
+    // Byte offset of vertex attribute (if non-interleaved data, then grab offset from decl instead)
+    *offset = base + (vdecl->data_type == GS_GRAPHICS_VERTEX_DATA_NONINTERLEAVED ? vdecl->offset : is_manual ? pip->layout[i].offset : 
+                    gsgl_get_vertex_attr_byte_offest(pip->layout, i));
+
+    return vbo;
+}
+
+void gsgl_vao_setup(gsgl_data_t* ogl, gsgl_pipeline_t* pip, gsgl_vao_t* vao)
+{
+    for (uint32_t i = 0; i < gs_dyn_array_size(pip->layout); ++i)
+    {
+        size_t stride = 0, offset = 0;
+        gsgl_buffer_t vbo = gsgl_vao_attrib(ogl, pip, i, &stride, &offset);
+
+        // Bind buffer
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+        // If there is a vertex divisor for this layout, then we'll draw instanced
+        vao->instanced |= (pip->layout[i].divisor != 0);
+
+        // Enable the vertex attribute pointer
+        glEnableVertexAttribArray(i);
+
+        switch (pip->layout[i].format)
+        {
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT4: glVertexAttribPointer(i, 4, GL_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT3: glVertexAttribPointer(i, 3, GL_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT2: glVertexAttribPointer(i, 2, GL_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT:  glVertexAttribPointer(i, 1, GL_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_UINT4:  glVertexAttribIPointer(i, 4, GL_UNSIGNED_INT, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_UINT3:  glVertexAttribIPointer(i, 3, GL_UNSIGNED_INT, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_UINT2:  glVertexAttribIPointer(i, 2, GL_UNSIGNED_INT, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_UINT:   glVertexAttribIPointer(i, 1, GL_UNSIGNED_INT, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE:   glVertexAttribPointer(i, 1, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE2:  glVertexAttribPointer(i, 2, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE3:  glVertexAttribPointer(i, 3, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
+            case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE4:  glVertexAttribPointer(i, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
+
+            // Shouldn't get here
+            default: {
+                gs_assert(false);
+            } break;
+        }
+        // Set up divisor (for instancing)
+        glVertexAttribDivisor(i, pip->layout[i].divisor);
+    } 
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Element buffer is part of the vao
+    size_t ibo_base = 0;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gsgl_stream_ibo(ogl, &ibo_base));
+}
+
+// Binds the vao for the current pipeline layout and bindings, creating it on first use
+gsgl_vao_t* gsgl_vao_bind(gsgl_data_t* ogl, gsgl_pipeline_t* pip)
+{
+    // Everything gsgl_vao_setup() reads. Ring offsets are left out, streamed attributes get rebound below instead.
+    size_t base = 0;
+    bool streamed = false;
+    gs_dyn_array_clear(ogl->vao_key);
+    gs_dyn_array_push(ogl->vao_key, gsgl_stream_ibo(ogl, &base));
+    for (uint32_t i = 0; i < gs_dyn_array_size(pip->layout); ++i)
+    {
+        const gs_graphics_vertex_attribute_desc_t* attr = &pip->layout[i];
+        const gsgl_vertex_buffer_decl_t* vdecl = i < gs_dyn_array_size(ogl->cache.vdecls) ? &ogl->cache.vdecls[i] : &ogl->cache.vdecls[0];
+        const gsgl_buffer_t vbo = gsgl_stream_vbo(ogl, vdecl, &base);
+        streamed |= (vbo == ogl->stream.buffer);
+        gs_dyn_array_push(ogl->vao_key, (uint32_t)attr->format);
+        gs_dyn_array_push(ogl->vao_key, (uint32_t)attr->stride);
+        gs_dyn_array_push(ogl->vao_key, (uint32_t)attr->offset);
+        gs_dyn_array_push(ogl->vao_key, (uint32_t)attr->divisor);
+        gs_dyn_array_push(ogl->vao_key, vbo);
+        gs_dyn_array_push(ogl->vao_key, (uint32_t)vdecl->data_type);
+        gs_dyn_array_push(ogl->vao_key, (uint32_t)vdecl->offset);
+        gs_dyn_array_push(ogl->vao_key, (uint32_t)((uint64_t)vdecl->offset >> 32));
+    }
+    const size_t key_sz = gs_dyn_array_size(ogl->vao_key) * sizeof(uint32_t);
+    const uint64_t hash = (uint64_t)gs_hash_bytes(ogl->vao_key, key_sz, 0x9e3779b9);
+
+    gsgl_vao_t* vao = gs_hash_table_exists(ogl->vaos, hash) ? gs_hash_table_getp(ogl->vaos, hash) : NULL;
+    if (vao && gs_dyn_array_size(vao->key) * sizeof(uint32_t) == key_sz && memcmp(vao->key, ogl->vao_key, key_sz) == 0) {
+        gsgl_state_vao(vao->id);
+
+        // Point streamed attributes at this update's region of the ring
+        CHECK_GL_CORE(
+            for (uint32_t i = 0; streamed && i < gs_dyn_array_size(pip->layout); ++i)
+            {
+                size_t stride = 0, offset = 0;
+                if (gsgl_vao_attrib(ogl, pip, i, &stride, &offset) != ogl->stream.buffer) continue;
+                if (!stride) stride = gsgl_get_byte_size_of_vertex_attribute(pip->layout[i].format);
+                glBindVertexBuffer(i, ogl->stream.buffer, offset, stride);
+            }
+        );
+        return vao;
+    }
+
+    // Hash collision, the new binding set takes the slot
+    if (vao) {
+        if (ogl->state.vao == vao->id) gsgl_state_vao_default();
+        glDeleteVertexArrays(1, &vao->id);
+        gs_dyn_array_free(vao->key);
+        gs_hash_table_erase(ogl->vaos, hash);
+    }
+    else if (gs_hash_table_size(ogl->vaos) >= GSGL_VAO_CACHE_MAX) {
+        gsgl_vao_cache_flush(ogl);
+    }
+
+    gsgl_vao_t v = gs_default_val();
+    glGenVertexArrays(1, &v.id);
+    gsgl_state_vao(v.id);
+    gsgl_vao_setup(ogl, pip, &v);
+    gs_dyn_array_reserve(v.key, gs_dyn_array_size(ogl->vao_key));
+    for (uint32_t i = 0; i < gs_dyn_array_size(ogl->vao_key); ++i) {
+        gs_dyn_array_push(v.key, ogl->vao_key[i]);
+    }
+    gs_hash_table_insert(ogl->vaos, hash, v);
+    return gs_hash_table_getp(ogl->vaos, hash);
+}
+
 size_t gsgl_uniform_data_size_in_bytes(gs_graphics_uniform_type type)
 {
     size_t sz = 0;
@@ -646,6 +1341,10 @@ gs_graphics_destroy(gs_graphics_t* graphics)
 
     // Free data cache
     gs_dyn_array_free(ogl->cache.vdecls);
+    gsgl_vao_cache_flush(ogl);
+    gs_hash_table_free(ogl->vaos);
+    gs_dyn_array_free(ogl->vao_key);
+    gsgl_stream_shutdown(ogl);
 
     gs_free(graphics);
     graphics = NULL;
@@ -843,7 +1542,6 @@ gs_graphics_uniform_create_impl(const gs_graphics_uniform_desc_t* desc)
         u.type = gsgl_uniform_type_to_gl_uniform_type(layout->type);
         u.size = gsgl_uniform_data_size_in_bytes(layout->type);
         u.count = layout->count ? layout->count : 1;
-        u.location = UINT32_MAX;
 
         // Add to size of ul
         ul.size += u.size * u.count;
@@ -891,6 +1589,7 @@ gs_graphics_index_buffer_create_impl(const gs_graphics_index_buffer_desc_t* desc
     }
 
     glGenBuffers(1, &buffer);
+    gsgl_state_vao_default();
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, desc->size, desc->data, gsgl_buffer_usage_to_gl_enum(desc->usage));
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
@@ -913,6 +1612,7 @@ gs_graphics_uniform_buffer_create_impl(const gs_graphics_uniform_buffer_desc_t*
     gsgl_uniform_buffer_t u = gs_default_val();
     memcpy(u.name, desc->name, 64);
     u.size = desc->size;
+    u.data_size = desc->size;
     u.location = UINT32_MAX;
 
     // Generate buffer (if needed)
@@ -1179,6 +1879,8 @@ gs_graphics_pipeline_create_impl(const gs_graphics_pipeline_desc_t* desc)
         gs_dyn_array_push(pipe.layout, desc->layout.attrs[i]);
     }
 
+    // Uniform locations are resolved per list on first bind, lists this pipeline never binds cost nothing
+
     // Create handle and return
     return (gs_handle_create(gs_graphics_pipeline_t, gs_slot_array_insert(ogl->pipelines, pipe)));
 }
@@ -1202,6 +1904,19 @@ gs_graphics_uniform_destroy_impl(gs_handle(gs_graphics_uniform_t) hndl)
     gsgl_uniform_list_t* ul = gs_slot_array_getp(ogl->uniforms, hndl.id);
     gs_dyn_array_free(ul->uniforms);
     gs_slot_array_erase(ogl->uniforms, hndl.id);
+
+    // Id can be reused by a different list, so pipelines resolve it again on next use
+    for (
+        gs_slot_array_iter it = gs_slot_array_iter_new(ogl->pipelines);
+        gs_slot_array_iter_valid(ogl->pipelines, it);
+        gs_slot_array_iter_advance(ogl->pipelines, it)
+    )
+    {
+        gsgl_pipeline_t* pip = gs_slot_array_iter_getp(ogl->pipelines, it);
+        if (hndl.id < gs_dyn_array_size(pip->uniform_table)) {
+            pip->uniform_table[hndl.id].resolved = false;
+        }
+    }
 }
 
 GS_API_DECL void 
@@ -1209,8 +1924,12 @@ gs_graphics_shader_destroy_impl(gs_handle(gs_graphics_shader_t) hndl)
 {
     gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
     if (!gs_slot_array_handle_valid(ogl->shaders, hndl.id)) return;
-    glDeleteProgram(gs_slot_array_get(ogl->shaders, hndl.id));
+    const uint32_t program = gs_slot_array_get(ogl->shaders, hndl.id);
+    glDeleteProgram(program);
     gs_slot_array_erase(ogl->shaders, hndl.id);
+
+    // Name can be reused by the next program created
+    if (ogl->state.program == program) ogl->state.known &= ~(1u << GSGL_STATE_PROGRAM);
 }
 
 GS_API_DECL void 
@@ -1219,6 +1938,8 @@ gs_graphics_vertex_buffer_destroy_impl(gs_handle(gs_graphics_vertex_buffer_t) hn
     gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
     if (!gs_slot_array_handle_valid(ogl->vertex_buffers, hndl.id)) return;
     gsgl_buffer_t buffer = gs_slot_array_get(ogl->vertex_buffers, hndl.id); 
+    gsgl_stream_release(ogl->stream.vbos, hndl.id);
+    gsgl_vao_cache_flush(ogl);
     glDeleteBuffers(1, &buffer);
     gs_slot_array_erase(ogl->vertex_buffers, hndl.id);
 }
@@ -1229,6 +1950,8 @@ gs_graphics_index_buffer_destroy_impl(gs_handle(gs_graphics_index_buffer_t) hndl
     gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
     if (!gs_slot_array_handle_valid(ogl->index_buffers, hndl.id)) return;
     gsgl_buffer_t buffer = gs_slot_array_get(ogl->index_buffers, hndl.id); 
+    gsgl_stream_release(ogl->stream.ibos, hndl.id);
+    gsgl_vao_cache_flush(ogl);
     glDeleteBuffers(1, &buffer);
     gs_slot_array_erase(ogl->index_buffers, hndl.id);
 }
@@ -1254,6 +1977,9 @@ gs_graphics_storage_buffer_destroy_impl(gs_handle(gs_graphics_storage_buffer_t)
     if (!gs_slot_array_handle_valid(ogl->storage_buffers, hndl.id)) return;
     gsgl_storage_buffer_t* sb = gs_slot_array_getp(ogl->storage_buffers, hndl.id);
 
+    // Deleting unbinds it, and the name can be handed out again
+    if (ogl->state.indirect_buffer == sb->buffer) ogl->state.known &= ~(1u << GSGL_STATE_INDIRECT_BUFFER);
+
     // Delete buffer (if needed)
     glDeleteBuffers(1, &sb->buffer);
 
@@ -1287,8 +2013,10 @@ gs_graphics_pipeline_destroy_impl(gs_handle(gs_graphics_pipeline_t) hndl)
     if (!gs_slot_array_handle_valid(ogl->pipelines, hndl.id)) return;
     gsgl_pipeline_t* pip = gs_slot_array_getp(ogl->pipelines, hndl.id);
 
-    // Free layout
+    // Free layout and binding table
     gs_dyn_array_free(pip->layout);
+    gs_dyn_array_free(pip->uniform_table);
+    gs_dyn_array_free(pip->uniform_locations);
 
     // Erase handles from slot arrays
     gs_slot_array_erase(ogl->pipelines, hndl.id);
@@ -1317,6 +2045,26 @@ gs_graphics_pipeline_desc_query(gs_handle(gs_graphics_pipeline_t) hndl, gs_graph
     } 
 }
 
+typedef struct gsgl_texture_readback_t
+{
+    gsgl_texture_t* tex;
+    gs_graphics_texture_desc_t* out;
+} gsgl_texture_readback_t;
+
+GS_API_PRIVATE void
+gsgl_texture_readback(void* user_data)
+{
+    gsgl_texture_readback_t* rb = (gsgl_texture_readback_t*)user_data;
+    gsgl_texture_t* tex = rb->tex;
+    gs_graphics_texture_desc_t* out = rb->out;
+    uint32_t type =  gsgl_texture_format_to_gl_data_type(tex->desc.format);
+    uint32_t format = gsgl_texture_format_to_gl_texture_format(tex->desc.format); 
+    CHECK_GL_CORE(
+        glActiveTexture(GL_TEXTURE0);
+        glGetTextureSubImage(tex->id, 0, out->read.x, out->read.y, 0, out->read.width, out->read.height, 1, format, type, out->read.size, out->data);
+    );
+}
+
 GS_API_DECL void 
 gs_graphics_texture_desc_query(gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* out)
 {
@@ -1325,20 +2073,37 @@ gs_graphics_texture_desc_query(gs_handle(gs_graphics_texture_t) hndl, gs_graphic
     gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data; 
     gsgl_texture_t* tex = gs_slot_array_getp(ogl->textures, hndl.id);
 
-    // Read back pixels
-    if (out->read.width && out->read.height)
+    // Read back pixels (on the render thread when one owns the context)
+    if (out->read.width && out->read.height && tex->id)
     {
-        uint32_t type =  gsgl_texture_format_to_gl_data_type(tex->desc.format);
-        uint32_t format = gsgl_texture_format_to_gl_texture_format(tex->desc.format); 
-        CHECK_GL_CORE(
-            glActiveTexture(GL_TEXTURE0);
-            glGetTextureSubImage(tex->id, 0, out->read.x, out->read.y, 0, out->read.width, out->read.height, 1, format, type, out->read.size, out->data);
-        );
+        gsgl_texture_readback_t rb = gs_default_val();
+        rb.tex = tex;
+        rb.out = out;
+        gs_graphics_render_thread_exec(gsgl_texture_readback, &rb);
     } 
 
     *out = tex->desc; 
 }
 
+GS_API_DECL gs_graphics_state_stats_t
+gs_graphics_state_stats()
+{
+    return gsgl_state()->stats;
+}
+
+GS_API_PRIVATE void
+gsgl_state_invalidate_cb(void* user_data)
+{
+    gsgl_state_invalidate(gsgl_state());
+}
+
+GS_API_DECL void
+gs_graphics_state_invalidate()
+{
+    // Shadow belongs to whichever thread owns the context
+    gs_graphics_render_thread_exec(gsgl_state_invalidate_cb, NULL);
+}
+
 GS_API_DECL size_t 
 gs_graphics_uniform_size_query(gs_handle(gs_graphics_uniform_t) hndl)
 { 
@@ -1399,6 +2164,7 @@ gs_graphics_vertex_buffer_update_impl(gs_handle(gs_graphics_vertex_buffer_t) hnd
 
     gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
     gsgl_buffer_t buffer = gs_slot_array_get(ogl->vertex_buffers, hndl.id);
+    gsgl_stream_release(ogl->stream.vbos, hndl.id);
     glBindBuffer(GL_ARRAY_BUFFER, buffer); 
     int32_t glusage = gsgl_buffer_usage_to_gl_enum(desc->usage);
     switch (desc->update.type) 
@@ -1415,6 +2181,8 @@ gs_graphics_index_buffer_update_impl(gs_handle(gs_graphics_index_buffer_t) hndl,
     gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
     gsgl_buffer_t buffer = gs_slot_array_get(ogl->index_buffers, hndl.id);
     int32_t glusage = gsgl_buffer_usage_to_gl_enum(desc->usage);
+    gsgl_stream_release(ogl->stream.ibos, hndl.id);
+    gsgl_state_vao_default();
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
     switch (desc->update.type) {
         case GS_GRAPHICS_BUFFER_UPDATE_SUBDATA: glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, desc->update.offset, desc->size, desc->data); break;
@@ -1864,6 +2632,27 @@ void gs_graphics_draw(gs_command_buffer_t* cb, gs_graphics_draw_desc_t* desc)
     });
 }
 
+void gs_graphics_draw_indirect(gs_command_buffer_t* cb, gs_graphics_draw_indirect_desc_t* desc)
+{
+    __ogl_push_command(cb, GS_OPENGL_OP_DRAW_INDIRECT, {
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->buffer.id);
+        gs_byte_buffer_write(&cb->commands, size_t, desc->offset);
+        gs_byte_buffer_write(&cb->commands, uint32_t, 1);
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->stride);
+    });
+}
+
+void gs_graphics_multi_draw_indirect(gs_command_buffer_t* cb, gs_graphics_draw_indirect_desc_t* desc)
+{
+    if (!desc->draw_count) return;
+    __ogl_push_command(cb, GS_OPENGL_OP_DRAW_INDIRECT, {
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->buffer.id);
+        gs_byte_buffer_write(&cb->commands, size_t, desc->offset);
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->draw_count);
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->stride);
+    });
+}
+
 void gs_graphics_dispatch_compute(gs_command_buffer_t* cb, uint32_t num_x_groups, uint32_t num_y_groups, uint32_t num_z_groups)
 {
     __ogl_push_command(cb, GS_OPENGL_OP_DISPATCH_COMPUTE, {
@@ -1884,6 +2673,8 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 
     gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
 
+    gs_profile_begin("gs_graphics_command_buffer_submit");
+
     // Set read position of buffer to beginning
     gs_byte_buffer_seek_to_beg(&cb->commands);
 
@@ -1943,14 +2734,13 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 
                 glBindFramebuffer(GL_FRAMEBUFFER, 0);
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
                 CHECK_GL_CORE(
                     glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
                 );
-                glDisable(GL_SCISSOR_TEST);
-                glDisable(GL_DEPTH_TEST);
-                glDisable(GL_STENCIL_TEST);
-                glDisable(GL_BLEND);
+                gsgl_state_enable(GSGL_STATE_SCISSOR_TEST, false);
+                gsgl_state_enable(GSGL_STATE_DEPTH_TEST, false);
+                gsgl_state_enable(GSGL_STATE_STENCIL_TEST, false);
+                gsgl_state_enable(GSGL_STATE_BLEND, false);
             } break;
 
             case GS_OPENGL_OP_CLEAR:
@@ -1977,7 +2767,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                     }
                     if (action.flag & GS_GRAPHICS_CLEAR_STENCIL || action.flag == 0x00) {
                         bit |= GL_STENCIL_BUFFER_BIT;
-                        glStencilMask(~0);
+                        gsgl_state_stencil_mask(~0);
                     }
 
                     glClear(bit);
@@ -1991,7 +2781,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                 gs_byte_buffer_readc(&cb->commands, uint32_t, w);
                 gs_byte_buffer_readc(&cb->commands, uint32_t, h);
 
-                glViewport(x, y, w, h);
+                gsgl_state_viewport(x, y, w, h);
             } break;
 
             case GS_OPENGL_OP_SET_VIEW_SCISSOR:
@@ -2001,8 +2791,8 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                 gs_byte_buffer_readc(&cb->commands, uint32_t, w);
                 gs_byte_buffer_readc(&cb->commands, uint32_t, h); 
 
-                glEnable(GL_SCISSOR_TEST);
-                glScissor(x, y, w, h);
+                gsgl_state_enable(GSGL_STATE_SCISSOR_TEST, true);
+                gsgl_state_scissor(x, y, w, h);
             } break;
 
             case GS_OPENGL_OP_APPLY_BINDINGS:
@@ -2044,6 +2834,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 
                             // If the data type is non-interleaved, then push size into vertex buffer decl
                             gsgl_vertex_buffer_decl_t vbo_decl = gs_default_val();
+                            vbo_decl.id = id;
                             vbo_decl.vbo = vbo;
                             vbo_decl.data_type = data_type;
                             vbo_decl.offset = offset;
@@ -2110,47 +2901,17 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                             // Get uniform
                             gsgl_uniform_list_t* ul = gs_slot_array_getp(ogl->uniforms, id);
 
-                            // Get bound shader from pipeline (either compute or raster)
-                            uint32_t sid = pip->compute.shader.id ? pip->compute.shader.id : pip->raster.shader.id;
+                            // Locations are resolved for this pipeline the first time it binds this list
+                            const int32_t* locations = gsgl_pipeline_uniform_locations(ogl, pip, id);
+                            if (!locations) {
+                                gs_byte_buffer_advance_position(&cb->commands, sz);
+                                continue;
+                            }
 
-                            // Check uniform location. If UINT32_T max, then must construct and place location
                             for (uint32_t ui = 0; ui < gs_dyn_array_size(ul->uniforms); ++ui)
                             {
                                 gsgl_uniform_t* u = &ul->uniforms[ui];
-
-                                // Searching for location if not bound or sid doesn't match previous use
-                                if ((u->location == UINT32_MAX && u->location != UINT32_MAX - 1) || u->sid != pip->raster.shader.id) 
-                                {
-                                    if (!sid || !gs_slot_array_exists(ogl->shaders, sid)) {
-                                        /*
-                                        gs_timed_action(1000, {
-                                            gs_println("Warning:Bind Uniform:Shader %d does not exist.", sid);
-                                        });
-                                        */
-
-                                        // Advance by size of uniform
-                                        gs_byte_buffer_advance_position(&cb->commands, sz);
-                                        continue;
-                                    }
-
-                                    gsgl_shader_t shader = gs_slot_array_get(ogl->shaders, sid);
-
-                                    // Construct temp name, concat with base name + uniform field name
-                                    char name[256] = gs_default_val();
-                                    memcpy(name, ul->name, 64);
-                                    gs_snprintfc(UTMP, 256, "%s%s", ul->name, u->name);
-                                    memcpy(name, UTMP, 256);
-
-                                    // Grab location of uniform based on name
-                                    u->location = glGetUniformLocation(shader, *name ? name : "__EMPTY_UNIFORM_NAME");
-
-                                    if (u->location >= UINT32_MAX) {
-                                        gs_println("Warning: Bind Uniform: Uniform not found: \"%s\"", name);
-                                        u->location = UINT32_MAX - 1;
-                                    }
-
-                                    u->sid = pip->raster.shader.id;
-                                }
+                                const int32_t location = locations[ui];
 
                                 // Switch on uniform type to upload data
                                 switch (u->type) 
@@ -2166,7 +2927,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                             gs_byte_buffer_readc(&cb->commands, float, v);
                                             gs_dyn_array_push(ogl->uniform_data.flt, v);
                                         }
-                                        glUniform1fv(u->location, ct, ogl->uniform_data.flt); 
+                                        glUniform1fv(location, ct, ogl->uniform_data.flt); 
                                     } break;
 
                                     case GSGL_UNIFORMTYPE_INT: 
@@ -2179,7 +2940,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                             gs_byte_buffer_readc(&cb->commands, int32_t, v);
                                             gs_dyn_array_push(ogl->uniform_data.i32, v);
                                         }
-                                        glUniform1iv(u->location, ct, ogl->uniform_data.i32); 
+                                        glUniform1iv(location, ct, ogl->uniform_data.i32); 
                                     } break;
 
                                     case GSGL_UNIFORMTYPE_VEC2: 
@@ -2192,7 +2953,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                             gs_byte_buffer_readc(&cb->commands, gs_vec2, v);
                                             gs_dyn_array_push(ogl->uniform_data.vec2, v);
                                         }
-                                        glUniform2fv(u->location, ct, (float*)ogl->uniform_data.vec2); 
+                                        glUniform2fv(location, ct, (float*)ogl->uniform_data.vec2); 
                                     } break;
 
                                     case GSGL_UNIFORMTYPE_VEC3: 
@@ -2205,7 +2966,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                             gs_byte_buffer_readc(&cb->commands, gs_vec3, v);
                                             gs_dyn_array_push(ogl->uniform_data.vec3, v);
                                         }
-                                        glUniform3fv(u->location, ct, (float*)ogl->uniform_data.vec3); 
+                                        glUniform3fv(location, ct, (float*)ogl->uniform_data.vec3); 
                                     } break;
 
                                     case GSGL_UNIFORMTYPE_VEC4: 
@@ -2218,7 +2979,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                             gs_byte_buffer_readc(&cb->commands, gs_vec4, v);
                                             gs_dyn_array_push(ogl->uniform_data.vec4, v);
                                         }
-                                        glUniform4fv(u->location, ct, (float*)ogl->uniform_data.vec4); 
+                                        glUniform4fv(location, ct, (float*)ogl->uniform_data.vec4); 
                                     } break;
 
                                     case GSGL_UNIFORMTYPE_MAT4: 
@@ -2231,7 +2992,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                             gs_byte_buffer_readc(&cb->commands, gs_mat4, v);
                                             gs_dyn_array_push(ogl->uniform_data.mat4, v);
                                         }
-                                        glUniformMatrix4fv(u->location, ct, false, (float*)ogl->uniform_data.mat4); 
+                                        glUniformMatrix4fv(location, ct, false, (float*)ogl->uniform_data.mat4); 
                                     } break;
 
                                     case GSGL_UNIFORMTYPE_SAMPLERCUBE:
@@ -2264,7 +3025,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                         } 
 
                                         // Bind uniforms
-                                        glUniform1iv(u->location, ct, (int32_t*)binds);
+                                        glUniform1iv(location, ct, (int32_t*)binds);
 
                                     } break;
 
@@ -2347,7 +3108,11 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                 u->sid = pip->raster.shader.id;
                             }
 
-                            glBindBufferRange(GL_UNIFORM_BUFFER, binding, u->ubo, range_offset, range_size ? range_size : u->size);
+                            if (u->stream) {
+                                glBindBufferRange(GL_UNIFORM_BUFFER, binding, ogl->stream.buffer, u->stream_offset + range_offset, range_size ? range_size : u->data_size);
+                            } else {
+                                glBindBufferRange(GL_UNIFORM_BUFFER, binding, u->ubo, range_offset, range_size ? range_size : u->data_size);
+                            }
 
                         } break;
 
@@ -2494,7 +3259,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                 {
                     /* Shader */
                     if (pip->compute.shader.id && gs_slot_array_exists(ogl->shaders, pip->compute.shader.id)) {
-                        glUseProgram(gs_slot_array_get(ogl->shaders, pip->compute.shader.id));
+                        gsgl_state_program(gs_slot_array_get(ogl->shaders, pip->compute.shader.id));
                     } 
                     else {
                         /*
@@ -2510,54 +3275,54 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                 /* Depth */
                 if (!pip->depth.func) {
                     // If no depth function (default), then disable
-                    glDisable(GL_DEPTH_TEST);
+                    gsgl_state_enable(GSGL_STATE_DEPTH_TEST, false);
                 }
                 else {
-                    glEnable(GL_DEPTH_TEST);    
-                    glDepthFunc(gsgl_depth_func_to_gl_depth_func(pip->depth.func));
+                    gsgl_state_enable(GSGL_STATE_DEPTH_TEST, true);
+                    gsgl_state_depth_func(gsgl_depth_func_to_gl_depth_func(pip->depth.func));
                 } 
-                glDepthMask(gsgl_depth_mask_to_gl_mask(pip->depth.mask));
+                gsgl_state_depth_mask(gsgl_depth_mask_to_gl_mask(pip->depth.mask));
 
                 /* Stencil */
                 if (!pip->stencil.func) {
                     // If no stencil function (default), then disable
-                    glDisable(GL_STENCIL_TEST); 
+                    gsgl_state_enable(GSGL_STATE_STENCIL_TEST, false);
                 } else {
-                    glEnable(GL_STENCIL_TEST);  
+                    gsgl_state_enable(GSGL_STATE_STENCIL_TEST, true);
                     uint32_t func = gsgl_stencil_func_to_gl_stencil_func(pip->stencil.func);
                     uint32_t sfail = gsgl_stencil_op_to_gl_stencil_op(pip->stencil.sfail);
                     uint32_t dpfail = gsgl_stencil_op_to_gl_stencil_op(pip->stencil.dpfail);
                     uint32_t dppass = gsgl_stencil_op_to_gl_stencil_op(pip->stencil.dppass);
-                    glStencilFunc(func, pip->stencil.ref, pip->stencil.comp_mask);
-                    glStencilMask(pip->stencil.write_mask);
-                    glStencilOp(sfail, dpfail, dppass);
+                    gsgl_state_stencil_func(func, pip->stencil.ref, pip->stencil.comp_mask);
+                    gsgl_state_stencil_mask(pip->stencil.write_mask);
+                    gsgl_state_stencil_op(sfail, dpfail, dppass);
                 }
 
                 /* Blend */
                 if (!pip->blend.func) {
-                    glDisable(GL_BLEND);
+                    gsgl_state_enable(GSGL_STATE_BLEND, false);
                 } else {
-                    glEnable(GL_BLEND);
-                    glBlendEquation(gsgl_blend_equation_to_gl_blend_eq(pip->blend.func));
-                    glBlendFunc(gsgl_blend_mode_to_gl_blend_mode(pip->blend.src, GL_ONE), 
+                    gsgl_state_enable(GSGL_STATE_BLEND, true);
+                    gsgl_state_blend_equation(gsgl_blend_equation_to_gl_blend_eq(pip->blend.func));
+                    gsgl_state_blend_func(gsgl_blend_mode_to_gl_blend_mode(pip->blend.src, GL_ONE), 
                         gsgl_blend_mode_to_gl_blend_mode(pip->blend.dst, GL_ZERO));
                 }
 
                 /* Raster */
                 // Face culling
                 if (!pip->raster.face_culling) {
-                    glDisable(GL_CULL_FACE);    
+                    gsgl_state_enable(GSGL_STATE_CULL_FACE, false);
                 } else {
-                    glEnable(GL_CULL_FACE); 
-                    glCullFace(gsgl_cull_face_to_gl_cull_face(pip->raster.face_culling));   
+                    gsgl_state_enable(GSGL_STATE_CULL_FACE, true);
+                    gsgl_state_cull_face(gsgl_cull_face_to_gl_cull_face(pip->raster.face_culling));   
                 }
 
                 // Winding order
-                glFrontFace(gsgl_winding_order_to_gl_winding_order(pip->raster.winding_order));
+                gsgl_state_front_face(gsgl_winding_order_to_gl_winding_order(pip->raster.winding_order));
 
                 /* Shader */
                 if (pip->raster.shader.id && gs_slot_array_exists(ogl->shaders, pip->raster.shader.id)) {
-                    glUseProgram(gs_slot_array_get(ogl->shaders, pip->raster.shader.id));
+                    gsgl_state_program(gs_slot_array_get(ogl->shaders, pip->raster.shader.id));
                 } 
                 else {
                     /*
@@ -2610,74 +3375,15 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                 // Grab currently bound pipeline (TODO(john): assert if this isn't valid)
                 gsgl_pipeline_t* pip = gs_slot_array_getp(ogl->pipelines, ogl->cache.pipeline.id);
 
-                // Must have a vertex buffer bound to draw
-                if (gs_dyn_array_empty(ogl->cache.vdecls)) {
+                // Must have a vertex buffer bound to source attributes from (attribute-less draws don't)
+                const bool no_vbo = gs_dyn_array_empty(ogl->cache.vdecls) && !gs_dyn_array_empty(pip->layout);
+                if (no_vbo) {
                     gs_timed_action(1000, { 
                         gs_println("Error:Opengl:Draw: No vertex buffer bound.");
                     });
                     // gs_assert(false);
                 }
 
-                // Keep track whether or not the data is to be instanced
-                bool is_instanced = false;
-
-                for (uint32_t i = 0; i < gs_dyn_array_size(pip->layout); ++i)
-                {
-                    // Vertex buffer to bind
-                    uint32_t vbo_idx = i; //pip->layout[i].buffer_idx;
-                    gsgl_vertex_buffer_decl_t vdecl = vbo_idx < gs_dyn_array_size(ogl->cache.vdecls) ? ogl->cache.vdecls[vbo_idx] : ogl->cache.vdecls[0];
-                    gsgl_buffer_t vbo = vdecl.vbo;
-
-                    // Manual override. If you manually set divisor/stride/offset, then will not automatically calculate any of those.
-                    bool is_manual = pip->layout[i].stride | pip->layout[i].divisor | pip->layout[i].offset | (vdecl.data_type == GS_GRAPHICS_VERTEX_DATA_NONINTERLEAVED);
-
-                    // Bind buffer
-                    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-
-                    // Stride of vertex attribute
-                    size_t stride = is_manual ? pip->layout[i].stride : 
-                                        gsgl_calculate_vertex_size_in_bytes(pip->layout, gs_dyn_array_size(pip->layout));
-
-                    // Byte offset of vertex attribute (if non-interleaved data, then grab offset from decl instead)
-                    size_t offset = vdecl.data_type == GS_GRAPHICS_VERTEX_DATA_NONINTERLEAVED ? vdecl.offset : is_manual ? pip->layout[i].offset : 
-                                        gsgl_get_vertex_attr_byte_offest(pip->layout, i);
-
-                    // If there is a vertex divisor for this layout, then we'll draw instanced
-                    is_instanced |= (pip->layout[i].divisor != 0);
-
-                    // Enable the vertex attribute pointer
-                    glEnableVertexAttribArray(i);
-
-                    switch (pip->layout[i].format)
-                    {
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT4: glVertexAttribPointer(i, 4, GL_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT3: glVertexAttribPointer(i, 3, GL_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT2: glVertexAttribPointer(i, 2, GL_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT:  glVertexAttribPointer(i, 1, GL_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_UINT4:  glVertexAttribIPointer(i, 4, GL_UNSIGNED_INT, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_UINT3:  glVertexAttribIPointer(i, 3, GL_UNSIGNED_INT, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_UINT2:  glVertexAttribIPointer(i, 2, GL_UNSIGNED_INT, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_UINT:   glVertexAttribIPointer(i, 1, GL_UNSIGNED_INT, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE:   glVertexAttribPointer(i, 1, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE2:  glVertexAttribPointer(i, 2, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE3:  glVertexAttribPointer(i, 3, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
-                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE4:  glVertexAttribPointer(i, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
-
-                        // Shouldn't get here
-                        default: {
-                            gs_assert(false);
-                        } break;
-                    }
-                    // Set up divisor (for instancing)
-                    glVertexAttribDivisor(i, pip->layout[i].divisor);
-                    glBindBuffer(GL_ARRAY_BUFFER, 0);
-                } 
-
-                // Bind all vertex buffers after setting up data and pointers
-                for (uint32_t i = 0; i < gs_dyn_array_size(ogl->cache.vdecls); ++i) {
-                    glBindBuffer(GL_ARRAY_BUFFER, ogl->cache.vdecls[i].vbo);
-                } 
-
                 // Draw based on bound primitive type in raster 
                 gs_byte_buffer_readc(&cb->commands, uint32_t, start);
                 gs_byte_buffer_readc(&cb->commands, uint32_t, count);
@@ -2688,25 +3394,35 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 
                 range_end = (range_end && range_end > range_start) ? range_end : start + count;
 
-                // Bind element buffer ranged
-                if (ogl->cache.ibo) {
-                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gs_slot_array_get(ogl->index_buffers, ogl->cache.ibo));
+                if (no_vbo) {
+                    continue;
                 }
 
+                // Attribute setup and buffer bindings live in a vao cached for this binding set
+                gsgl_vao_t* vao = gsgl_vao_bind(ogl, pip);
+
+                // Keep track whether or not the data is to be instanced
+                bool is_instanced = vao->instanced;
+
                 // If instance count > 1, do instanced drawing
                 is_instanced |= (instance_count > 1);
 
                 uint32_t prim = gsgl_primitive_to_gl_primitive(pip->raster.primitive);
                 uint32_t itype = gsgl_index_buffer_size_to_gl_index_type(pip->raster.index_buffer_element_size);
 
+                // Streamed indices sit at an offset into the ring
+                size_t ibo_base = 0;
+                gsgl_stream_ibo(ogl, &ibo_base);
+                const size_t ioffset = ibo_base + start;
+
                 // Draw
                 if (ogl->cache.ibo) { 
                     #ifdef GS_GRAPHICS_IMPL_OPENGL_CORE
-                        if (is_instanced)   glDrawElementsInstancedBaseVertex(prim, count, itype, gs_int2voidp(start), instance_count, base_vertex);
-                        else                glDrawRangeElementsBaseVertex(prim, range_start, range_end, count, itype, gs_int2voidp(start), base_vertex);
+                        if (is_instanced)   glDrawElementsInstancedBaseVertex(prim, count, itype, gs_int2voidp(ioffset), instance_count, base_vertex);
+                        else                glDrawRangeElementsBaseVertex(prim, range_start, range_end, count, itype, gs_int2voidp(ioffset), base_vertex);
                     #else
-                        if (is_instanced)   glDrawElementsInstanced(prim, count, itype, gs_int2voidp(start), instance_count);
-                        else                glDrawElements(prim, count, itype, gs_int2voidp(start));
+                        if (is_instanced)   glDrawElementsInstanced(prim, count, itype, gs_int2voidp(ioffset), instance_count);
+                        else                glDrawElements(prim, count, itype, gs_int2voidp(ioffset));
                     #endif
                 } 
                 else {
@@ -2716,6 +3432,56 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 
             } break;
 
+            case GS_OPENGL_OP_DRAW_INDIRECT:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, sb_slot_id);
+                gs_byte_buffer_readc(&cb->commands, size_t, offset);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, draw_count);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, stride);
+
+                // Multi-draw indirect is GL 4.3, macOS contexts stop at 4.1
+                CHECK_GL_CORE(
+                    if (!GLAD_GL_VERSION_4_3) {
+                        gs_timed_action(1000, {
+                            gs_println("Warning:Opengl:DrawIndirect: Requires OpenGL 4.3.");
+                        });
+                        continue;
+                    }
+                )
+
+                gsgl_pipeline_t* pip = gs_slot_array_getp(ogl->pipelines, ogl->cache.pipeline.id);
+
+                // Attribute-less draws need no vertex buffer
+                if (gs_dyn_array_empty(ogl->cache.vdecls) && !gs_dyn_array_empty(pip->layout)) {
+                    gs_timed_action(1000, { 
+                        gs_println("Error:Opengl:DrawIndirect: No vertex buffer bound.");
+                    });
+                    continue;
+                }
+
+                if (!sb_slot_id || !gs_slot_array_exists(ogl->storage_buffers, sb_slot_id)) {
+                    gs_timed_action(1000, {
+                        gs_println("Warning:Opengl:DrawIndirect: Storage buffer %d does not exist.", sb_slot_id);
+                    });
+                    continue;
+                }
+
+                gsgl_storage_buffer_t* sbo = gs_slot_array_getp(ogl->storage_buffers, sb_slot_id);
+
+                // Command indices are relative to the start of the index buffer, move streamed ones out of the ring
+                gsgl_stream_resolve(ogl, GS_GRAPHICS_BUFFER_INDEX, ogl->cache.ibo);
+                gsgl_vao_bind(ogl, pip);
+
+                uint32_t prim = gsgl_primitive_to_gl_primitive(pip->raster.primitive);
+                uint32_t itype = gsgl_index_buffer_size_to_gl_index_type(pip->raster.index_buffer_element_size);
+
+                gsgl_state_indirect_buffer(sbo->buffer);
+                CHECK_GL_CORE(
+                    if (ogl->cache.ibo) glMultiDrawElementsIndirect(prim, itype, gs_int2voidp(offset), draw_count, stride);
+                    else                glMultiDrawArraysIndirect(prim, gs_int2voidp(offset), draw_count, stride);
+                )
+            } break;
+
             case GS_OPENGL_OP_REQUEST_TEXTURE_UPDATE:
             {
                 gs_byte_buffer_readc(&cb->commands, uint32_t, tex_slot_id);
@@ -2768,12 +3534,29 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 
                 int32_t glusage = gsgl_buffer_usage_to_gl_enum(usage);
 
+                // Whole-buffer stream updates go to the ring when it has room
+                const void* data = (cb->commands.data + cb->commands.position);
+                const bool stream = usage == GS_GRAPHICS_BUFFER_USAGE_STREAM && update_type != GS_GRAPHICS_BUFFER_UPDATE_SUBDATA;
+                size_t stream_offset = 0;
+
                 switch (type)
                 {
                     // Vertex Buffer
                     default:
                     case GS_GRAPHICS_BUFFER_VERTEX:
                     {
+                        if (stream && gsgl_stream_write(&ogl->stream, data, sz, 16, &stream_offset)) {
+                            gsgl_stream_alloc_t* a = gsgl_stream_slot(&ogl->stream.vbos, id);
+                            if (!a->active) gsgl_stream_track(&ogl->stream, GS_GRAPHICS_BUFFER_VERTEX, id);
+                            a->offset = stream_offset;
+                            a->size = sz;
+                            a->active = true;
+                            break;
+                        }
+
+                        // Partial updates apply on top of the streamed data, full ones replace the storage
+                        if (update_type == GS_GRAPHICS_BUFFER_UPDATE_SUBDATA) gsgl_stream_resolve(ogl, GS_GRAPHICS_BUFFER_VERTEX, id);
+                        else gsgl_stream_release(ogl->stream.vbos, id);
                         gsgl_buffer_t buffer = gs_slot_array_get(ogl->vertex_buffers, id);
                         glBindBuffer(GL_ARRAY_BUFFER, buffer);
                         switch (update_type) {
@@ -2785,7 +3568,20 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 
                     case GS_GRAPHICS_BUFFER_INDEX:
                     {
+                        if (stream && gsgl_stream_write(&ogl->stream, data, sz, 16, &stream_offset)) {
+                            gsgl_stream_alloc_t* a = gsgl_stream_slot(&ogl->stream.ibos, id);
+                            if (!a->active) gsgl_stream_track(&ogl->stream, GS_GRAPHICS_BUFFER_INDEX, id);
+                            a->offset = stream_offset;
+                            a->size = sz;
+                            a->active = true;
+                            break;
+                        }
+
+                        // Partial updates apply on top of the streamed data, full ones replace the storage
+                        if (update_type == GS_GRAPHICS_BUFFER_UPDATE_SUBDATA) gsgl_stream_resolve(ogl, GS_GRAPHICS_BUFFER_INDEX, id);
+                        else gsgl_stream_release(ogl->stream.ibos, id);
                         gsgl_buffer_t buffer = gs_slot_array_get(ogl->index_buffers, id);
+                        gsgl_state_vao_default();
                         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
                         switch (update_type) {
                             case GS_GRAPHICS_BUFFER_UPDATE_SUBDATA: glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, sz, (cb->commands.data + cb->commands.position)); break;
@@ -2799,6 +3595,18 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                         // Have to 
                         gsgl_uniform_buffer_t* u = gs_slot_array_getp(ogl->uniform_buffers, id);
 
+                        if (stream && gsgl_stream_write(&ogl->stream, data, sz, ogl->stream.ubo_align, &stream_offset)) {
+                            if (!u->stream) gsgl_stream_track(&ogl->stream, GS_GRAPHICS_BUFFER_UNIFORM, id);
+                            u->stream = true;
+                            u->stream_offset = stream_offset;
+                            u->data_size = sz;
+                            break;
+                        }
+
+                        // Partial updates apply on top of the streamed data
+                        if (update_type == GS_GRAPHICS_BUFFER_UPDATE_SUBDATA) gsgl_stream_resolve(ogl, GS_GRAPHICS_BUFFER_UNIFORM, id);
+                        u->stream = false;
+
                         glBindBuffer(GL_UNIFORM_BUFFER, u->ubo);
 
                         switch (update_type) {
@@ -2808,6 +3616,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                             default: {
                                 // Reset uniform size
                                 u->size = sz;
+                                u->data_size = sz;
                                 // Recreate buffer
                                 glBufferData(GL_UNIFORM_BUFFER, sz, (cb->commands.data + cb->commands.position), glusage);
                             } break;
@@ -2847,12 +3656,126 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
             }
         }
     }
+
+    // Ring data written by this buffer is free once the GPU gets past its commands
+    gsgl_stream_resolve_live(ogl);
+    gsgl_stream_fence(&ogl->stream);
     
     // Clear byte buffer of commands
     gs_byte_buffer_clear(&cb->commands);
 
     // Set num commands to 0
     cb->num_commands = 0;
+
+    gs_profile_end();
+}
+
+/* Headless (no context): resources get valid handles and descriptions but never reach a device */
+
+#define GSGL_NULL_CREATE(NAME, T, DESC, SA, GLT)\
+    GS_API_PRIVATE gs_handle(T) NAME(const DESC* desc)\
+    {\
+        gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;\
+        GLT obj = gs_default_val();\
+        return gs_handle_create(T, gs_slot_array_insert(ogl->SA, obj));\
+    }
+
+#define GSGL_NULL_DESTROY(NAME, T, SA)\
+    GS_API_PRIVATE void NAME(gs_handle(T) hndl)\
+    {\
+        gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;\
+        if (gs_slot_array_handle_valid(ogl->SA, hndl.id)) gs_slot_array_erase(ogl->SA, hndl.id);\
+    }
+
+GSGL_NULL_CREATE(gsgl_null_shader_create, gs_graphics_shader_t, gs_graphics_shader_desc_t, shaders, gsgl_shader_t)
+GSGL_NULL_CREATE(gsgl_null_vertex_buffer_create, gs_graphics_vertex_buffer_t, gs_graphics_vertex_buffer_desc_t, vertex_buffers, gsgl_buffer_t)
+GSGL_NULL_CREATE(gsgl_null_index_buffer_create, gs_graphics_index_buffer_t, gs_graphics_index_buffer_desc_t, index_buffers, gsgl_buffer_t)
+GSGL_NULL_CREATE(gsgl_null_uniform_buffer_create, gs_graphics_uniform_buffer_t, gs_graphics_uniform_buffer_desc_t, uniform_buffers, gsgl_uniform_buffer_t)
+GSGL_NULL_CREATE(gsgl_null_storage_buffer_create, gs_graphics_storage_buffer_t, gs_graphics_storage_buffer_desc_t, storage_buffers, gsgl_storage_buffer_t)
+GSGL_NULL_CREATE(gsgl_null_framebuffer_create, gs_graphics_framebuffer_t, gs_graphics_framebuffer_desc_t, frame_buffers, gsgl_buffer_t)
+
+GSGL_NULL_DESTROY(gsgl_null_texture_destroy, gs_graphics_texture_t, textures)
+GSGL_NULL_DESTROY(gsgl_null_shader_destroy, gs_graphics_shader_t, shaders)
+GSGL_NULL_DESTROY(gsgl_null_vertex_buffer_destroy, gs_graphics_vertex_buffer_t, vertex_buffers)
+GSGL_NULL_DESTROY(gsgl_null_index_buffer_destroy, gs_graphics_index_buffer_t, index_buffers)
+GSGL_NULL_DESTROY(gsgl_null_uniform_buffer_destroy, gs_graphics_uniform_buffer_t, uniform_buffers)
+GSGL_NULL_DESTROY(gsgl_null_storage_buffer_destroy, gs_graphics_storage_buffer_t, storage_buffers)
+GSGL_NULL_DESTROY(gsgl_null_framebuffer_destroy, gs_graphics_framebuffer_t, frame_buffers)
+
+GS_API_PRIVATE gs_handle(gs_graphics_texture_t) 
+gsgl_null_texture_create(const gs_graphics_texture_desc_t* desc)
+{
+    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
+    gsgl_texture_t tex = gs_default_val();
+    tex.desc = *desc;
+    memset(tex.desc.data, 0, sizeof(tex.desc.data));
+    return gs_handle_create(gs_graphics_texture_t, gs_slot_array_insert(ogl->textures, tex));
+}
+
+GS_API_PRIVATE void 
+gsgl_null_texture_update(gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* desc)
+{
+    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
+    if (!desc || !gs_slot_array_handle_valid(ogl->textures, hndl.id)) return;
+    gsgl_texture_t* tex = gs_slot_array_getp(ogl->textures, hndl.id);
+    tex->desc = *desc;
+    memset(tex->desc.data, 0, sizeof(tex->desc.data));
+}
+
+GS_API_PRIVATE void gsgl_null_texture_read(gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* desc) {}
+GS_API_PRIVATE void gsgl_null_vertex_buffer_update(gs_handle(gs_graphics_vertex_buffer_t) hndl, gs_graphics_vertex_buffer_desc_t* desc) {}
+GS_API_PRIVATE void gsgl_null_index_buffer_update(gs_handle(gs_graphics_index_buffer_t) hndl, gs_graphics_index_buffer_desc_t* desc) {}
+GS_API_PRIVATE void gsgl_null_storage_buffer_update(gs_handle(gs_graphics_storage_buffer_t) hndl, gs_graphics_storage_buffer_desc_t* desc) {}
+GS_API_PRIVATE void* gsgl_null_storage_buffer_map_get(gs_handle(gs_graphics_storage_buffer_t) hndl) {return NULL;}
+GS_API_PRIVATE void* gsgl_null_storage_buffer_lock(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t sz) {return NULL;}
+GS_API_PRIVATE void gsgl_null_storage_buffer_unlock(gs_handle(gs_graphics_storage_buffer_t) hndl) {}
+GS_API_PRIVATE void gsgl_null_storage_buffer_get_data(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t stride, void* out) {}
+
+GS_API_PRIVATE void 
+gsgl_null_command_buffer_submit(gs_command_buffer_t* cb)
+{
+    gs_byte_buffer_clear(&cb->commands);
+    cb->num_commands = 0;
+}
+
+GS_API_PRIVATE void
+gsgl_init_null(gs_graphics_t* graphics)
+{
+    // Context free impls are shared with the GL path
+    graphics->api.texture_create = gsgl_null_texture_create;
+    graphics->api.uniform_create = gs_graphics_uniform_create_impl;
+    graphics->api.shader_create = gsgl_null_shader_create;
+    graphics->api.vertex_buffer_create = gsgl_null_vertex_buffer_create;
+    graphics->api.index_buffer_create = gsgl_null_index_buffer_create;
+    graphics->api.uniform_buffer_create = gsgl_null_uniform_buffer_create;
+    graphics->api.storage_buffer_create = gsgl_null_storage_buffer_create;
+    graphics->api.framebuffer_create = gsgl_null_framebuffer_create;
+    graphics->api.renderpass_create = gs_graphics_renderpass_create_impl;
+    graphics->api.pipeline_create = gs_graphics_pipeline_create_impl;
+
+    graphics->api.texture_destroy = gsgl_null_texture_destroy;
+    graphics->api.uniform_destroy = gs_graphics_uniform_destroy_impl;
+    graphics->api.shader_destroy = gsgl_null_shader_destroy;
+    graphics->api.vertex_buffer_destroy = gsgl_null_vertex_buffer_destroy;
+    graphics->api.index_buffer_destroy = gsgl_null_index_buffer_destroy;
+    graphics->api.uniform_buffer_destroy = gsgl_null_uniform_buffer_destroy;
+    graphics->api.storage_buffer_destroy = gsgl_null_storage_buffer_destroy;
+    graphics->api.framebuffer_destroy = gsgl_null_framebuffer_destroy;
+    graphics->api.renderpass_destroy = gs_graphics_renderpass_destroy_impl;
+    graphics->api.pipeline_destroy = gs_graphics_pipeline_destroy_impl;
+
+    graphics->api.vertex_buffer_update = gsgl_null_vertex_buffer_update;
+    graphics->api.index_buffer_update = gsgl_null_index_buffer_update;
+    graphics->api.storage_buffer_update = gsgl_null_storage_buffer_update;
+    graphics->api.texture_update = gsgl_null_texture_update;
+    graphics->api.texture_read = gsgl_null_texture_read;
+
+    graphics->api.storage_buffer_map_get = gsgl_null_storage_buffer_map_get;
+    graphics->api.storage_buffer_lock = gsgl_null_storage_buffer_lock;
+    graphics->api.storage_buffer_unlock = gsgl_null_storage_buffer_unlock;
+    graphics->api.storage_buffer_get_data = gsgl_null_storage_buffer_get_data;
+
+    graphics->api.command_buffer_submit = gsgl_null_command_buffer_submit;
 }
 
 GS_API_DECL void 
@@ -2880,12 +3803,27 @@ gs_graphics_init(gs_graphics_t* graphics)
     gs_slot_array_insert(ogl->textures, tex);
     gs_slot_array_insert(ogl->storage_buffers, sb);
 
+    // Headless has no context to query or create objects in
+    if (gs_platform_headless()) {
+        gsgl_init_null(graphics);
+        return;
+    }
+
     // Construct vao then bind
     glGenVertexArrays(1, &ogl->cache.vao);      
     glBindVertexArray(ogl->cache.vao);
 
     // Reset data cache for rendering ops
     gsgl_reset_data_cache(&ogl->cache);
+    gsgl_state_invalidate(&ogl->state);
+
+    // Always on, no longer reset per pipeline
+    CHECK_GL_CORE(
+        glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+    );
+
+    // Ring for streamed buffer updates
+    gsgl_stream_init(ogl);
 
     // Init info object
     gs_graphics_info_t* info = &gs_subsystem(graphics)->info;
@@ -27,6 +27,9 @@
     #include <sys/stat.h>
     #include <dirent.h>
     #include <dlfcn.h>  // dlopen, RTLD_LAZY, dlsym
+    #include <fcntl.h>  // open
+    #include <unistd.h> // close, sysconf
+    #include <sys/mman.h>
 #else
 	#include "../external/dirent/dirent.h"
     #include <direct.h>
@@ -43,9 +46,16 @@ gs_platform_create()
     // Initialize windows
     platform->windows = gs_slot_array_new(gs_platform_window_t);
 
+    // Fixed event queue, no allocation after startup
+    gs_assert((GS_PLATFORM_EVENT_QUEUE_SIZE & (GS_PLATFORM_EVENT_QUEUE_SIZE - 1)) == 0);
+    platform->events.data = (gs_platform_event_t*)gs_malloc(GS_PLATFORM_EVENT_QUEUE_SIZE * sizeof(gs_platform_event_t));
+    platform->events.mask = GS_PLATFORM_EVENT_QUEUE_SIZE - 1;
+
     // Set up video mode (for now, just do opengl)
     platform->settings.video.driver = GS_PLATFORM_VIDEO_DRIVER_TYPE_OPENGL;
 
+    platform->event_budget = GS_PLATFORM_EVENT_BUDGET_MS;
+
     return platform;
 }
 
@@ -56,6 +66,8 @@ gs_platform_destroy(gs_platform_t* platform)
 
     // Free all resources
     gs_slot_array_free(platform->windows);
+    gs_free(platform->events.data);
+    gs_dyn_array_free(platform->injected);
 
     // Free platform
     gs_free(platform);
@@ -67,7 +79,13 @@ gs_platform_window_create(const gs_platform_window_desc_t* desc)
 { 
     gs_assert(gs_instance() != NULL);
     gs_platform_t* platform = gs_subsystem(platform);
-    gs_platform_window_t win = gs_platform_window_create_internal(desc); 
+    gs_platform_window_t win = gs_default_val();
+    if (platform->headless.enabled) {
+        // Virtual window without native handle, sizes are synthetic
+        win.window_size = win.framebuffer_size = gs_v2((float)desc->width, (float)desc->height);
+    } else {
+        win = gs_platform_window_create_internal(desc); 
+    }
 
     // Insert and return handle
     return (gs_slot_array_insert(platform->windows, win));
@@ -372,20 +390,20 @@ void gs_platform_update(gs_platform_t* platform)
 bool gs_platform_poll_events(gs_platform_event_t* evt, bool32_t consume)
 {
     gs_platform_t* platform = gs_subsystem(platform);
+    gs_platform_event_queue_t* q = &platform->events;
 
     if (!evt) return false;
-    if (gs_dyn_array_empty(platform->events)) return false;
-    if (evt->idx >= gs_dyn_array_size(platform->events)) return false;
+    if (q->head == q->tail) return false;
 
     if (consume) {
-        // Back event
-        *evt = gs_dyn_array_back(platform->events);
-        // Pop back
-        gs_dyn_array_pop(platform->events);
+        // Front event, oldest first
+        *evt = q->data[q->head++ & q->mask];
+        evt->idx = 0;
     }
     else {
         uint32_t idx = evt->idx;
-        *evt = platform->events[idx++]; 
+        if (idx >= q->tail - q->head) return false;
+        *evt = q->data[(q->head + idx++) & q->mask]; 
         evt->idx = idx;
     }
 
@@ -395,8 +413,41 @@ bool gs_platform_poll_events(gs_platform_event_t* evt, bool32_t consume)
 void gs_platform_add_event(gs_platform_event_t* evt)
 {
     gs_platform_t* platform = gs_subsystem(platform);
+    gs_platform_event_queue_t* q = &platform->events;
+    gs_platform_event_stats_t* stats = &platform->event_stats;
     if (!evt) return;
-    gs_dyn_array_push(platform->events, *evt);
+
+    // When full, drop the newest so indices of an in-progress iteration stay valid
+    if (q->tail - q->head > q->mask) {
+        stats->dropped++;
+        stats->total_dropped++;
+        return;
+    }
+
+    gs_platform_event_t* dst = &q->data[q->tail++ & q->mask];
+    *dst = *evt;
+    dst->idx = 0;
+    if (!dst->time) dst->time = gs_platform_elapsed_time_ns();
+    stats->queue_high_water = gs_max(stats->queue_high_water, q->tail - q->head);
+}
+
+void gs_platform_clear_events()
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    platform->events.head = platform->events.tail;
+    platform->event_stats.dropped = 0;
+}
+
+GS_API_DECL const gs_platform_event_stats_t* 
+gs_platform_event_stats()
+{
+    return &gs_subsystem(platform)->event_stats;
+}
+
+GS_API_DECL void 
+gs_platform_set_event_budget(float ms)
+{
+    gs_subsystem(platform)->event_budget = ms;
 }
 
 bool gs_platform_was_key_down(gs_platform_keycode code)
@@ -630,6 +681,10 @@ void gs_platform_release_key(gs_platform_keycode code)
 // Platform File IO
 char* gs_platform_read_file_contents_default_impl(const char* file_path, const char* mode, size_t* sz)
 {
+    // Mounted archives first
+    char* archived = gs_platform_archive_read(file_path, sz);
+    if (archived) return archived;
+
     const char* path = file_path;
 
     #ifdef GS_PLATFORM_ANDROID
@@ -656,6 +711,93 @@ char* gs_platform_read_file_contents_default_impl(const char* file_path, const c
     return buffer;
 }
 
+gs_platform_file_map_t gs_platform_file_map_default_impl(const char* file_path)
+{
+    gs_platform_file_map_t map = gs_default_val();
+    const char* path = file_path;
+
+    // Mounted archives first
+    if (gs_platform_archive_map(file_path, &map)) return map;
+
+    #ifdef GS_PLATFORM_ANDROID
+        const char* internal_data_path = gs_app()->android.internal_data_path;
+        gs_snprintfc(tmp_path, 1024, "%s/%s", internal_data_path, file_path);
+        path = tmp_path;
+    #endif
+
+    // The kernel zero-fills the tail of the last mapped page, which gives the view its '\0' terminator.
+    // Page-aligned sizes have no tail, so those (and platforms without mapping) get a heap copy instead.
+    #if (defined GS_PLATFORM_WIN)
+
+        do {
+            HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (file == INVALID_HANDLE_VALUE) return map;
+
+            LARGE_INTEGER fsz;
+            SYSTEM_INFO si;
+            GetSystemInfo(&si);
+            if (!GetFileSizeEx(file, &fsz) || fsz.QuadPart == 0 || (fsz.QuadPart % si.dwPageSize) == 0) {
+                CloseHandle(file);
+                break;
+            }
+
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            CloseHandle(file);
+            if (!mapping) break;
+            map.data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);  // View holds its own reference
+            if (!map.data) break;
+            map.size = (size_t)fsz.QuadPart;
+            return map;
+        } while (0);
+
+    #elif (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_APPLE || defined GS_PLATFORM_ANDROID)
+
+        do {
+            int32_t fd = open(path, O_RDONLY);
+            if (fd < 0) return map;
+
+            struct stat st;
+            const size_t page_sz = (size_t)sysconf(_SC_PAGESIZE);
+            if (fstat(fd, &st) != 0 || st.st_size == 0 || ((size_t)st.st_size % page_sz) == 0) {
+                close(fd);
+                break;
+            }
+
+            void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);  // Mapping holds its own reference
+            if (view == MAP_FAILED) break;
+            map.data = (const char*)view;
+            map.size = (size_t)st.st_size;
+            return map;
+        } while (0);
+
+    #endif
+
+    // Heap fallback
+    map.data = gs_platform_read_file_contents(file_path, "rb", &map.size);
+    map.heap = map.data != NULL;
+    return map;
+}
+
+void gs_platform_file_unmap_default_impl(gs_platform_file_map_t* map)
+{
+    if (!map || !map->data) return;
+
+    if (map->archive) {
+        // Owned by the mounted archive
+    } else if (map->heap) {
+        gs_free((void*)map->data);
+    } else {
+        #if (defined GS_PLATFORM_WIN)
+            UnmapViewOfFile(map->data);
+        #elif (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_APPLE || defined GS_PLATFORM_ANDROID)
+            munmap((void*)map->data, map->size);
+        #endif
+    }
+    memset(map, 0, sizeof(gs_platform_file_map_t));
+}
+
 gs_result gs_platform_write_file_contents_default_impl(const char* file_path, const char* mode, void* data, size_t sz)
 {
     const char* path = file_path;
@@ -702,6 +844,8 @@ GS_API_DECL int32_t gs_platform_mkdir_default_impl(const char* dir_path, int32_t
 
 bool gs_platform_file_exists_default_impl(const char* file_path)
 {
+    if (gs_platform_archive_contains(file_path)) return true;
+
     const char* path = file_path;
 
     #ifdef GS_PLATFORM_ANDROID
@@ -720,6 +864,9 @@ bool gs_platform_file_exists_default_impl(const char* file_path)
 
 int32_t gs_platform_file_size_in_bytes_default_impl(const char* file_path)
 {
+    int32_t archived = gs_platform_archive_file_size(file_path);
+    if (archived >= 0) return archived;
+
     #ifdef GS_PLATFORM_WIN
 
         HANDLE hFile = CreateFile(file_path, GENERIC_READ, 
@@ -1014,8 +1161,10 @@ GS_API_DECL void gs_platform_update_internal(gs_platform_t* platform)
 { 
     gs_platform_input_t* input = &platform->input; 
 
-    // Platform time
-    platform->time.elapsed = (glfwGetTime() * 1000.0);
+    // Headless windows are virtual, their cached state is authoritative
+    if (platform->headless.enabled) {
+        return;
+    }
 
     // Update all window/framebuffer state
     for (
@@ -1626,7 +1775,37 @@ void __glfw_frame_buffer_size_callback(GLFWwindow* window, s32 width, s32 height
 
 void gs_platform_process_input(gs_platform_input_t* input)
 {
-    glfwPollEvents();
+    // glfwPollEvents() already drains every window's queue and can't be budgeted, so only
+    // record counters. Native events aren't visible here; count the events they produced.
+    gs_platform_t* platform = gs_subsystem(platform);
+    gs_platform_event_stats_t* stats = &platform->event_stats;
+    const uint32_t count = platform->events.tail;
+    const double start = glfwGetTime();
+
+    if (!platform->headless.enabled) glfwPollEvents();
+
+    stats->events = platform->events.tail - count;
+    stats->backlog = stats->events > 1 ? stats->events - 1 : 0;
+    stats->windows = gs_slot_array_size(platform->windows);
+    stats->budget_exceeded = false;
+    stats->pump_time = (float)((glfwGetTime() - start) * 1000.0);
+    stats->pump_time_max = gs_max(stats->pump_time_max, stats->pump_time);
+    stats->total_events += stats->events;
+    stats->total_backlog += stats->backlog;
+}
+
+GS_API_DECL void
+gs_platform_wait_events(float timeout)
+{
+    // Callbacks queue the events, gs_platform_process_input() picks them up with the rest
+    if (timeout > 0.f) glfwWaitEventsTimeout((double)timeout / 1000.0);
+    else glfwWaitEvents();
+}
+
+GS_API_DECL void
+gs_platform_wake_internal()
+{
+    glfwPostEmptyEvent();
 }
 
 /*== Platform Util == */
@@ -1650,7 +1829,7 @@ void  gs_platform_sleep(float ms)
 	    struct timespec ts = gs_default_val();
 	    int32_t res = 0;
 	    ts.tv_sec = ms / 1000.f;
-	    ts.tv_nsec = ((uint64_t)ms % 1000) * 1000000;
+	    ts.tv_nsec = (long)((ms - (float)ts.tv_sec * 1000.f) * 1000000.f);  // Keep the fractional ms
 	    do {
 		res = nanosleep(&ts, &ts);
 	    } while (res && errno == EINTR);
@@ -1662,8 +1841,28 @@ void  gs_platform_sleep(float ms)
 GS_API_DECL double 
 gs_platform_elapsed_time()
 { 
-    gs_platform_t* platform = gs_subsystem(platform);
-    return platform->time.elapsed;
+    return gs_platform_ticks_to_ms(gs_platform_ticks());
+}
+
+GS_API_DECL uint64_t 
+gs_platform_elapsed_time_ns()
+{
+    // OS clock rather than glfw's timer, which reads 0 until glfwInit() (and headless never calls it)
+    gs_t* inst = gs_instance();
+    if (inst && inst->ctx.platform && inst->ctx.platform->headless.virtual_clock) {
+        return inst->ctx.platform->headless.time;
+    }
+    #if (defined GS_PLATFORM_WIN)
+        LARGE_INTEGER freq, v;
+        QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&v);
+        return ((uint64_t)v.QuadPart / freq.QuadPart) * 1000000000ull + 
+            (((uint64_t)v.QuadPart % freq.QuadPart) * 1000000000ull) / freq.QuadPart;
+    #else
+        struct timespec ts = gs_default_val();
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+    #endif
 }
 
 /*== Platform Video == */
@@ -1671,6 +1870,7 @@ gs_platform_elapsed_time()
 GS_API_DECL void
 gs_platform_enable_vsync(int32_t enabled)
 {
+    if (gs_platform_headless()) return;
     glfwSwapInterval(enabled ? 1 : 0);
 }
 
@@ -1789,6 +1989,7 @@ gs_platform_set_dropped_files_callback(uint32_t handle, gs_dropped_files_callbac
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, handle);
+    if (!win->hndl) return;
     glfwSetDropCallback((GLFWwindow*)win->hndl, (GLFWdropfun)cb);
 }
 
@@ -1797,6 +1998,7 @@ gs_platform_set_window_close_callback(uint32_t handle, gs_window_close_callback_
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, handle);
+    if (!win->hndl) return;
     glfwSetWindowCloseCallback((GLFWwindow*)win->hndl, (GLFWwindowclosefun)cb);
 }
 
@@ -1805,6 +2007,7 @@ gs_platform_set_character_callback(uint32_t handle, gs_character_callback_t cb)
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, handle);
+    if (!win->hndl) return;
     glfwSetCharCallback((GLFWwindow*)win->hndl, (GLFWcharfun)cb);
 }
 
@@ -1813,6 +2016,7 @@ gs_platform_set_framebuffer_resize_callback(uint32_t handle, gs_framebuffer_resi
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, handle);
+    if (!win->hndl) return;
     glfwSetFramebufferSizeCallback((GLFWwindow*)win->hndl, (GLFWframebuffersizefun)cb);
 }
 
@@ -1821,6 +2025,7 @@ gs_platform_mouse_set_position(uint32_t handle, float x, float y)
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, handle);
+    if (!win->hndl) return;
     glfwSetCursorPos((GLFWwindow*)win->hndl, x, y);
 }
 
@@ -1843,6 +2048,7 @@ gs_platform_window_swap_buffer(uint32_t handle)
 
     // Grab window from handle
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, handle);
+    if (!win->hndl) return;
     glfwSwapBuffers((GLFWwindow*)win->hndl);
 }
 
@@ -1851,6 +2057,7 @@ gs_platform_window_make_current(uint32_t hndl)
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, hndl);
+    if (!win->hndl) return;
     glfwMakeContextCurrent((GLFWwindow*)win->hndl);
 }
 
@@ -1890,6 +2097,8 @@ uint32_t gs_platform_window_height(uint32_t handle)
 bool32_t gs_platform_window_fullscreen(uint32_t handle)
 {
     gs_platform_window_t* window = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+
+    if (!window->hndl) return false;
     return glfwGetWindowMonitor((GLFWwindow*)window->hndl) != NULL;
 }
 
@@ -1909,18 +2118,24 @@ gs_vec2 gs_platform_window_positionv(uint32_t handle)
 void gs_platform_set_window_size(uint32_t handle, uint32_t w, uint32_t h)
 {
     gs_platform_window_t* window = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+
+    if (!window->hndl) { window->window_size = window->framebuffer_size = gs_v2((float)w, (float)h); return; }
     glfwSetWindowSize((GLFWwindow*)window->hndl, (int32_t)w, (int32_t)h);
 }
 
 void gs_platform_set_window_sizev(uint32_t handle, gs_vec2 v)
 {
     gs_platform_window_t* window = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+
+    if (!window->hndl) { window->window_size = window->framebuffer_size = v; return; }
     glfwSetWindowSize((GLFWwindow*)window->hndl, (uint32_t)v.x, (uint32_t)v.y);
 }
 
 void gs_platform_set_window_fullscreen(uint32_t handle, bool32_t fullscreen)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+
+    if (!win->hndl) return;
     GLFWmonitor* monitor = NULL;
 
     int32_t x, y, w, h;
@@ -1944,12 +2159,16 @@ void gs_platform_set_window_fullscreen(uint32_t handle, bool32_t fullscreen)
 void gs_platform_set_window_position(uint32_t handle, uint32_t x, uint32_t y)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+
+    if (!win->hndl) { win->window_position = gs_v2((float)x, (float)y); return; }
     glfwSetWindowPos((GLFWwindow*)win->hndl, (int32_t)x, (int32_t)y);
 }
 
 void gs_platform_set_window_positionv(uint32_t handle, gs_vec2 v)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+
+    if (!win->hndl) { win->window_position = v; return; }
     glfwSetWindowPos((GLFWwindow*)win->hndl, (int32_t)v.x, (int32_t)v.y);
 }
 
@@ -1983,6 +2202,7 @@ uint32_t gs_platform_framebuffer_height(uint32_t handle)
 
 GS_API_DECL gs_vec2 gs_platform_monitor_sizev(uint32_t id)
 {
+    if (gs_platform_headless()) return gs_platform_window_sizev(gs_platform_main_window());
     gs_vec2 ms = gs_v2s(0.f);
     int32_t width, height, xpos, ypos;
     int32_t count;
@@ -2005,11 +2225,15 @@ GS_API_DECL gs_vec2 gs_platform_monitor_sizev(uint32_t id)
 GS_API_DECL void gs_platform_window_set_clipboard(uint32_t handle, const char* str)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+
+    if (!win->hndl) return;
     glfwSetClipboardString((GLFWwindow*)win->hndl, str);
 }
 GS_API_DECL const char* gs_platform_window_get_clipboard(uint32_t handle)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+
+    if (!win->hndl) return "";
     return glfwGetClipboardString((GLFWwindow*)win->hndl);
 }
 
@@ -2017,6 +2241,7 @@ void gs_platform_set_cursor(uint32_t handle, gs_platform_cursor cursor)
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!win->hndl) return;
     GLFWcursor* cp = ((GLFWcursor*)platform->cursors[(u32)cursor]); 
     glfwSetCursor((GLFWwindow*)win->hndl, cp);
 }
@@ -2026,6 +2251,7 @@ void gs_platform_lock_mouse(uint32_t handle, bool32_t lock)
     __gs_input()->mouse.locked = lock;
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!win->hndl) return;
     glfwSetInputMode((GLFWwindow*)win->hndl, GLFW_CURSOR, lock ? GLFW_CURSOR_DISABLED : GLFW_CURSOR_NORMAL);
 
     // Not sure if I want to support this or not
@@ -2621,7 +2847,13 @@ gs_platform_shutdown(gs_platform_t* platform)
 GS_API_DECL double 
 gs_platform_elapsed_time()
 {
-    return emscripten_performance_now(); 
+    return gs_platform_ticks_to_ms(gs_platform_ticks()); 
+}
+
+GS_API_DECL uint64_t 
+gs_platform_elapsed_time_ns()
+{
+    return (uint64_t)(emscripten_performance_now() * 1000000.0); 
 }
 
 // Platform Video
@@ -2638,6 +2870,17 @@ gs_platform_sleep(float ms)
     emscripten_sleep((uint32_t)ms);   
 }
 
+GS_API_DECL void
+gs_platform_wait_events(float timeout)
+{
+    // Main loop is driven by the host, nothing to block on
+}
+
+GS_API_DECL void
+gs_platform_wake_internal()
+{
+}
+
 GS_API_DECL void gs_platform_update_internal(gs_platform_t* platform)
 {
 }
@@ -3602,8 +3845,15 @@ gs_platform_shutdown(gs_platform_t* platform)
 GS_API_DECL double
 gs_platform_elapsed_time()
 {
-    gs_android_t* android = GS_PLATFORM_ANDROID_DATA();
-    return ((double)clock() / (double)CLOCKS_PER_SEC) * 1000.0;
+    return gs_platform_ticks_to_ms(gs_platform_ticks());
+}
+
+GS_API_DECL uint64_t
+gs_platform_elapsed_time_ns()
+{
+    struct timespec ts = gs_default_val();
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
 }
 
 GS_API_DECL void   
@@ -3612,6 +3862,17 @@ gs_platform_sleep(float ms)
     usleep(ms * 1000.f);
 }
 
+GS_API_DECL void
+gs_platform_wait_events(float timeout)
+{
+    // Main loop is driven by the host, nothing to block on
+}
+
+GS_API_DECL void
+gs_platform_wake_internal()
+{
+}
+
 // Platform Video
 GS_API_DECL void 
 gs_platform_enable_vsync(int32_t enabled)
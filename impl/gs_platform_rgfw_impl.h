@@ -27,6 +27,9 @@
     #include <sys/stat.h>
     #include <dirent.h>
     #include <dlfcn.h>  // dlopen, RTLD_LAZY, dlsym
+    #include <fcntl.h>  // open
+    #include <unistd.h> // close, sysconf
+    #include <sys/mman.h>
 #else
 	#include "../external/dirent/dirent.h"
     #include <direct.h>
@@ -43,9 +46,16 @@ gs_platform_create()
     // Initialize windows
     platform->windows = gs_slot_array_new(gs_platform_window_t);
 
+    // Fixed event queue, no allocation after startup
+    gs_assert((GS_PLATFORM_EVENT_QUEUE_SIZE & (GS_PLATFORM_EVENT_QUEUE_SIZE - 1)) == 0);
+    platform->events.data = (gs_platform_event_t*)gs_malloc(GS_PLATFORM_EVENT_QUEUE_SIZE * sizeof(gs_platform_event_t));
+    platform->events.mask = GS_PLATFORM_EVENT_QUEUE_SIZE - 1;
+
     // Set up video mode (for now, just do opengl)
     platform->settings.video.driver = GS_PLATFORM_VIDEO_DRIVER_TYPE_OPENGL;
 
+    platform->event_budget = GS_PLATFORM_EVENT_BUDGET_MS;
+
     return platform;
 }
 
@@ -56,6 +66,8 @@ gs_platform_destroy(gs_platform_t* platform)
 
     // Free all resources
     gs_slot_array_free(platform->windows);
+    gs_free(platform->events.data);
+    gs_dyn_array_free(platform->injected);
 
     // Free platform
     gs_free(platform);
@@ -67,7 +79,13 @@ gs_platform_window_create(const gs_platform_window_desc_t* desc)
 { 
     gs_assert(gs_instance() != NULL);
     gs_platform_t* platform = gs_subsystem(platform);
-    gs_platform_window_t win = gs_platform_window_create_internal(desc); 
+    gs_platform_window_t win = gs_default_val();
+    if (platform->headless.enabled) {
+        // Virtual window without native handle, sizes are synthetic
+        win.window_size = win.framebuffer_size = gs_v2((float)desc->width, (float)desc->height);
+    } else {
+        win = gs_platform_window_create_internal(desc); 
+    }
 
     // Insert and return handle
     return (gs_slot_array_insert(platform->windows, win));
@@ -382,20 +400,20 @@ void gs_platform_update(gs_platform_t* platform)
 bool gs_platform_poll_events(gs_platform_event_t* evt, bool32_t consume)
 {
     gs_platform_t* platform = gs_subsystem(platform);
+    gs_platform_event_queue_t* q = &platform->events;
 
     if (!evt) return false;
-    if (gs_dyn_array_empty(platform->events)) return false;
-    if (evt->idx >= gs_dyn_array_size(platform->events)) return false;
+    if (q->head == q->tail) return false;
 
     if (consume) {
-        // Back event
-        *evt = gs_dyn_array_back(platform->events);
-        // Pop back
-        gs_dyn_array_pop(platform->events);
+        // Front event, oldest first
+        *evt = q->data[q->head++ & q->mask];
+        evt->idx = 0;
     }
     else {
         uint32_t idx = evt->idx;
-        *evt = platform->events[idx++]; 
+        if (idx >= q->tail - q->head) return false;
+        *evt = q->data[(q->head + idx++) & q->mask]; 
         evt->idx = idx;
     }
 
@@ -405,8 +423,41 @@ bool gs_platform_poll_events(gs_platform_event_t* evt, bool32_t consume)
 void gs_platform_add_event(gs_platform_event_t* evt)
 {
     gs_platform_t* platform = gs_subsystem(platform);
+    gs_platform_event_queue_t* q = &platform->events;
+    gs_platform_event_stats_t* stats = &platform->event_stats;
     if (!evt) return;
-    gs_dyn_array_push(platform->events, *evt);
+
+    // When full, drop the newest so indices of an in-progress iteration stay valid
+    if (q->tail - q->head > q->mask) {
+        stats->dropped++;
+        stats->total_dropped++;
+        return;
+    }
+
+    gs_platform_event_t* dst = &q->data[q->tail++ & q->mask];
+    *dst = *evt;
+    dst->idx = 0;
+    if (!dst->time) dst->time = gs_platform_elapsed_time_ns();
+    stats->queue_high_water = gs_max(stats->queue_high_water, q->tail - q->head);
+}
+
+void gs_platform_clear_events()
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    platform->events.head = platform->events.tail;
+    platform->event_stats.dropped = 0;
+}
+
+GS_API_DECL const gs_platform_event_stats_t* 
+gs_platform_event_stats()
+{
+    return &gs_subsystem(platform)->event_stats;
+}
+
+GS_API_DECL void 
+gs_platform_set_event_budget(float ms)
+{
+    gs_subsystem(platform)->event_budget = ms;
 }
 
 bool gs_platform_was_key_down(gs_platform_keycode code)
@@ -640,6 +691,10 @@ void gs_platform_release_key(gs_platform_keycode code)
 // Platform File IO
 char* gs_platform_read_file_contents_default_impl(const char* file_path, const char* mode, size_t* sz)
 {
+    // Mounted archives first
+    char* archived = gs_platform_archive_read(file_path, sz);
+    if (archived) return archived;
+
     const char* path = file_path;
 
     #ifdef GS_PLATFORM_ANDROID
@@ -666,6 +721,93 @@ char* gs_platform_read_file_contents_default_impl(const char* file_path, const c
     return buffer;
 }
 
+gs_platform_file_map_t gs_platform_file_map_default_impl(const char* file_path)
+{
+    gs_platform_file_map_t map = gs_default_val();
+    const char* path = file_path;
+
+    // Mounted archives first
+    if (gs_platform_archive_map(file_path, &map)) return map;
+
+    #ifdef GS_PLATFORM_ANDROID
+        const char* internal_data_path = gs_app()->android.internal_data_path;
+        gs_snprintfc(tmp_path, 1024, "%s/%s", internal_data_path, file_path);
+        path = tmp_path;
+    #endif
+
+    // The kernel zero-fills the tail of the last mapped page, which gives the view its '\0' terminator.
+    // Page-aligned sizes have no tail, so those (and platforms without mapping) get a heap copy instead.
+    #if (defined GS_PLATFORM_WIN)
+
+        do {
+            HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (file == INVALID_HANDLE_VALUE) return map;
+
+            LARGE_INTEGER fsz;
+            SYSTEM_INFO si;
+            GetSystemInfo(&si);
+            if (!GetFileSizeEx(file, &fsz) || fsz.QuadPart == 0 || (fsz.QuadPart % si.dwPageSize) == 0) {
+                CloseHandle(file);
+                break;
+            }
+
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            CloseHandle(file);
+            if (!mapping) break;
+            map.data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);  // View holds its own reference
+            if (!map.data) break;
+            map.size = (size_t)fsz.QuadPart;
+            return map;
+        } while (0);
+
+    #elif (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_APPLE || defined GS_PLATFORM_ANDROID)
+
+        do {
+            int32_t fd = open(path, O_RDONLY);
+            if (fd < 0) return map;
+
+            struct stat st;
+            const size_t page_sz = (size_t)sysconf(_SC_PAGESIZE);
+            if (fstat(fd, &st) != 0 || st.st_size == 0 || ((size_t)st.st_size % page_sz) == 0) {
+                close(fd);
+                break;
+            }
+
+            void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);  // Mapping holds its own reference
+            if (view == MAP_FAILED) break;
+            map.data = (const char*)view;
+            map.size = (size_t)st.st_size;
+            return map;
+        } while (0);
+
+    #endif
+
+    // Heap fallback
+    map.data = gs_platform_read_file_contents(file_path, "rb", &map.size);
+    map.heap = map.data != NULL;
+    return map;
+}
+
+void gs_platform_file_unmap_default_impl(gs_platform_file_map_t* map)
+{
+    if (!map || !map->data) return;
+
+    if (map->archive) {
+        // Owned by the mounted archive
+    } else if (map->heap) {
+        gs_free((void*)map->data);
+    } else {
+        #if (defined GS_PLATFORM_WIN)
+            UnmapViewOfFile(map->data);
+        #elif (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_APPLE || defined GS_PLATFORM_ANDROID)
+            munmap((void*)map->data, map->size);
+        #endif
+    }
+    memset(map, 0, sizeof(gs_platform_file_map_t));
+}
+
 gs_result gs_platform_write_file_contents_default_impl(const char* file_path, const char* mode, void* data, size_t sz)
 {
     const char* path = file_path;
@@ -712,6 +854,8 @@ GS_API_DECL int32_t gs_platform_mkdir_default_impl(const char* dir_path, int32_t
 
 bool gs_platform_file_exists_default_impl(const char* file_path)
 {
+    if (gs_platform_archive_contains(file_path)) return true;
+
     const char* path = file_path;
 
     #ifdef GS_PLATFORM_ANDROID
@@ -730,6 +874,9 @@ bool gs_platform_file_exists_default_impl(const char* file_path)
 
 int32_t gs_platform_file_size_in_bytes_default_impl(const char* file_path)
 {
+    int32_t archived = gs_platform_archive_file_size(file_path);
+    if (archived >= 0) return archived;
+
     #ifdef GS_PLATFORM_WIN
 
         HANDLE hFile = CreateFile(file_path, GENERIC_READ, 
@@ -951,12 +1098,29 @@ void __rgfw_drop_callback(RGFW_window* window);
 
 /*== Platform Init / Shutdown == */
 
+#if defined(RGFW_X11)
+    #include <poll.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+
+// Self-pipe that wakes gs_platform_wait_events(). RGFW_stopCheckEvents() isn't used on X11: 
+// RGFW_window_eventWait() doesn't drain its pipe until it returns, so it spins until the timeout.
+gs_global int32_t _gs_platform_rgfw_wake_pipe[2] = {-1, -1};
+#endif
+
 void gs_platform_init(gs_platform_t* pf)
 {
     gs_assert(pf);
 
     gs_println("Initializing RGFW");
 
+    #if defined(RGFW_X11)
+        if (pipe(_gs_platform_rgfw_wake_pipe) == 0) {
+            fcntl(_gs_platform_rgfw_wake_pipe[0], F_SETFL, O_NONBLOCK);
+            fcntl(_gs_platform_rgfw_wake_pipe[1], F_SETFL, O_NONBLOCK);
+        }
+    #endif
+
     u32 win_args = 0;
 
     switch (pf->settings.video.driver)
@@ -1000,8 +1164,10 @@ GS_API_DECL void gs_platform_update_internal(gs_platform_t* platform)
 { 
     gs_platform_input_t* input = &platform->input; 
 
-    // Platform time
-    platform->time.elapsed = (RGFW_getTime() * 1000.0);
+    // Headless windows are virtual, their cached state is authoritative
+    if (platform->headless.enabled) {
+        return;
+    }
 
     // Update all window/framebuffer state
     for (
@@ -1038,6 +1204,13 @@ void gs_platform_shutdown(gs_platform_t* pf)
         // glfwDestroyWindow(win);
     }
 
+    #if defined(RGFW_X11)
+        for (uint32_t i = 0; i < 2; ++i) {
+            if (_gs_platform_rgfw_wake_pipe[i] >= 0) close(_gs_platform_rgfw_wake_pipe[i]);
+            _gs_platform_rgfw_wake_pipe[i] = -1;
+        }
+    #endif
+
     // glfwTerminate();
 }
 
@@ -1449,17 +1622,123 @@ void __rgfw_frame_buffer_size_callback(RGFW_window* window, s32 width, s32 heigh
 
 /*== Platform Input == */
 
+// RGFW_window_checkEvent() returns NULL for native events it consumes but doesn't translate,
+// so NULL alone doesn't mean the queue is empty.
+gs_force_inline bool32_t 
+_gs_platform_rgfw_events_pending(RGFW_window* win)
+{
+#if defined(RGFW_X11)
+    return XPending((Display*)win->src.display) > 0;
+#else
+    return false;
+#endif
+}
+
 void gs_platform_process_input(gs_platform_input_t* input)
 {
-    // not sure why it's designed this way and I don't feel like figuring out how this is supposed to work
-    // this (the window abstraction system gunslinger has) shouldn't be as messy/complicated as it is
     gs_platform_t* platform = gs_subsystem(platform);
-    RGFW_window* win = platform->windows->data->hndl;
-    RGFW_window_checkEvent(win);
+    gs_platform_event_stats_t* stats = &platform->event_stats;
+    const uint64_t start = RGFW_getTimeNS();
+    const uint64_t budget = platform->event_budget > 0.f ? (uint64_t)(platform->event_budget * 1000000.0) : 0;
+
+    stats->events = 0;
+    stats->backlog = 0;
+    stats->windows = 0;
+    stats->budget_exceeded = false;
+
+    // Drain everything queued for every window, instead of one event per frame. The budget is
+    // checked between events; each window always gets at least one pass so none is starved.
+    for (
+        gs_slot_array_iter it = gs_slot_array_iter_new(platform->windows); 
+        gs_slot_array_iter_valid(platform->windows, it); 
+        gs_slot_array_iter_advance(platform->windows, it)
+    )
+    {
+        RGFW_window* win = (RGFW_window*)gs_slot_array_iter_getp(platform->windows, it)->hndl;
+        if (!win) continue;
+
+        uint32_t count = 0, passes = 0;
+        stats->windows++;
+
+        while (win->event.type != RGFW_quit) {
+            if (budget && passes && (RGFW_getTimeNS() - start) >= budget) {
+                stats->budget_exceeded = true;
+                break;
+            }
+            passes++;
+            if (RGFW_window_checkEvent(win)) count++;
+            else if (!_gs_platform_rgfw_events_pending(win)) break;
+        }
+
+        stats->events += count;
+        stats->backlog += count > 1 ? count - 1 : 0;
+    }
+
+    stats->pump_time = (float)((double)(RGFW_getTimeNS() - start) / 1000000.0);
+    stats->pump_time_max = gs_max(stats->pump_time_max, stats->pump_time);
+    stats->total_events += stats->events;
+    stats->total_backlog += stats->backlog;
+    stats->budget_exceeded_frames += stats->budget_exceeded ? 1 : 0;
+}
+
+#ifndef GS_PLATFORM_RGFW_WAIT_MAX_WINDOWS
+    #define GS_PLATFORM_RGFW_WAIT_MAX_WINDOWS 16
+#endif
+
+GS_API_DECL void
+gs_platform_wait_events(float timeout)
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    const int32_t ms = timeout > 0.f ? (int32_t)ceilf(timeout) : -1;
+
+#if defined(RGFW_X11)
+    // Every window has its own display connection
+    struct pollfd fds[GS_PLATFORM_RGFW_WAIT_MAX_WINDOWS + 1] = gs_default_val();
+    uint32_t ct = 0;
+    fds[ct].fd = _gs_platform_rgfw_wake_pipe[0];
+    fds[ct++].events = POLLIN;
+    for (
+        gs_slot_array_iter it = gs_slot_array_iter_new(platform->windows); 
+        gs_slot_array_iter_valid(platform->windows, it) && ct < gs_array_size(fds); 
+        gs_slot_array_iter_advance(platform->windows, it)
+    )
+    {
+        RGFW_window* win = (RGFW_window*)gs_slot_array_iter_getp(platform->windows, it)->hndl;
+        if (!win) continue;
+        Display* display = (Display*)win->src.display;
+        XFlush(display);
+        if (XPending(display) > 0) return;
+        fds[ct].fd = ConnectionNumber(display);
+        fds[ct++].events = POLLIN;
+    }
+
+    poll(fds, ct, ms);
+
+    if (fds[0].revents & POLLIN) {
+        char buf[64];
+        while (read(_gs_platform_rgfw_wake_pipe[0], buf, sizeof(buf)) > 0);
+    }
+#else
+    if (!gs_slot_array_size(platform->windows)) return;
+    RGFW_window_eventWait((RGFW_window*)platform->windows->data->hndl, ms < 0 ? RGFW_NEXT : ms);
+#endif
+}
+
+GS_API_DECL void
+gs_platform_wake_internal()
+{
+#if defined(RGFW_X11)
+    // Non-blocking, a full pipe already has a wake pending
+    const char byte = 0;
+    if (_gs_platform_rgfw_wake_pipe[1] >= 0) (void)!write(_gs_platform_rgfw_wake_pipe[1], &byte, 1);
+#else
+    RGFW_stopCheckEvents();
+#endif
 }
 
 /*== Platform Util == */
 #include <unistd.h>
+#include <errno.h>
 
 void  gs_platform_sleep(float ms)
 {
@@ -1480,10 +1759,10 @@ void  gs_platform_sleep(float ms)
 	    struct timespec ts = gs_default_val();
 	    int32_t res = 0;
 	    ts.tv_sec = ms / 1000.f;
-	    ts.tv_nsec = ((uint64_t)ms % 1000) * 1000000;
+	    ts.tv_nsec = (long)((ms - (float)ts.tv_sec * 1000.f) * 1000000.f);  // Keep the fractional ms
 	    do {
 		res = nanosleep(&ts, &ts);
-	    } while (res);
+	    } while (res && errno == EINTR);
 
             // usleep(ms * 1000.f); // unistd.h
     #endif
@@ -1492,8 +1771,17 @@ void  gs_platform_sleep(float ms)
 GS_API_DECL double 
 gs_platform_elapsed_time()
 { 
-    gs_platform_t* platform = gs_subsystem(platform);
-    return platform->time.elapsed;
+    return gs_platform_ticks_to_ms(gs_platform_ticks());
+}
+
+GS_API_DECL uint64_t 
+gs_platform_elapsed_time_ns()
+{
+    gs_t* inst = gs_instance();
+    if (inst && inst->ctx.platform && inst->ctx.platform->headless.virtual_clock) {
+        return inst->ctx.platform->headless.time;
+    }
+    return RGFW_getTimeNS();
 }
 
 /*== Platform Video == */
@@ -1501,6 +1789,7 @@ gs_platform_elapsed_time()
 GS_API_DECL void
 gs_platform_enable_vsync(int32_t enabled)
 {
+    if (gs_platform_headless()) return;
     gs_platform_t* platform = gs_subsystem(platform); 
     RGFW_window_swapInterval(platform->windows->data->hndl, enabled ? 1 : 0);
 }
@@ -1685,6 +1974,7 @@ gs_platform_mouse_set_position(uint32_t handle, float x, float y)
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, handle);
+    if (!win->hndl) return;
     RGFW_window_moveMouse((RGFW_window*)win->hndl, RGFW_POINT((i32)x, (i32)y));
 }
 
@@ -1707,6 +1997,7 @@ gs_platform_window_swap_buffer(uint32_t handle)
 
     // Grab window from handle
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, handle);
+    if (!win->hndl) return;
     RGFW_window_swapBuffers((RGFW_window*)win->hndl);
 }
 
@@ -1715,13 +2006,21 @@ gs_platform_window_make_current(uint32_t hndl)
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(platform->windows, hndl);
+    if (!win->hndl) return;
     RGFW_window_makeCurrent((RGFW_window*)win->hndl);
 }
 
 GS_API_DECL void     
 gs_platform_window_make_current_raw(void* win)
 {
-    RGFW_window_makeCurrent(win);
+#if defined(RGFW_X11) && defined(RGFW_OPENGL) && !defined(RGFW_EGL)
+    // RGFW releases with a NULL display, which Xlib dereferences
+    if (!win) {
+        if (RGFW_root) glXMakeCurrent((Display*)RGFW_root->src.display, None, NULL);
+        return;
+    }
+#endif
+    RGFW_window_makeCurrent((RGFW_window*)win);
 }
 
 GS_API_DECL gs_vec2 
@@ -1754,6 +2053,7 @@ uint32_t gs_platform_window_height(uint32_t handle)
 bool32_t gs_platform_window_fullscreen(uint32_t handle)
 {
     gs_platform_window_t* window = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!window->hndl) return false;
     return RGFW_window_isFullscreen(window->hndl);
 }
 
@@ -1773,18 +2073,21 @@ gs_vec2 gs_platform_window_positionv(uint32_t handle)
 void gs_platform_set_window_size(uint32_t handle, uint32_t w, uint32_t h)
 {
     gs_platform_window_t* window = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!window->hndl) { window->window_size = window->framebuffer_size = gs_v2((float)w, (float)h); return; }
     RGFW_window_resize((RGFW_window*)window->hndl, RGFW_AREA((uint32_t)w, (uint32_t)h));
 }
 
 void gs_platform_set_window_sizev(uint32_t handle, gs_vec2 v)
 {
     gs_platform_window_t* window = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!window->hndl) { window->window_size = window->framebuffer_size = v; return; }
     RGFW_window_resize((RGFW_window*)window->hndl, RGFW_AREA((uint32_t)v.x, (uint32_t)v.y));
 }
 
 void gs_platform_set_window_fullscreen(uint32_t handle, bool32_t fullscreen)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!win->hndl) return;
     RGFW_monitor monitor;
 
     int32_t x, y, w, h;
@@ -1810,12 +2113,14 @@ void gs_platform_set_window_fullscreen(uint32_t handle, bool32_t fullscreen)
 void gs_platform_set_window_position(uint32_t handle, uint32_t x, uint32_t y)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!win->hndl) { win->window_position = gs_v2((float)x, (float)y); return; }
     RGFW_window_move((RGFW_window*)win->hndl, RGFW_POINT((int32_t)x, (int32_t)y));
 }
 
 void gs_platform_set_window_positionv(uint32_t handle, gs_vec2 v)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!win->hndl) { win->window_position = v; return; }
     RGFW_window_move((RGFW_window*)win->hndl, RGFW_POINT((int32_t)v.x, (int32_t)v.y));
 }
 
@@ -1849,6 +2154,7 @@ uint32_t gs_platform_framebuffer_height(uint32_t handle)
 
 GS_API_DECL gs_vec2 gs_platform_monitor_sizev(uint32_t id)
 {
+    if (gs_platform_headless()) return gs_platform_window_sizev(gs_platform_main_window());
     gs_vec2 ms = gs_v2s(0.f);
     int32_t width, height, xpos, ypos;
     int32_t count;
@@ -1871,11 +2177,13 @@ GS_API_DECL gs_vec2 gs_platform_monitor_sizev(uint32_t id)
 GS_API_DECL void gs_platform_window_set_clipboard(uint32_t handle, const char* str)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!win->hndl) return;
     RGFW_writeClipboard(str, strlen(str));
 }
 GS_API_DECL const char* gs_platform_window_get_clipboard(uint32_t handle)
 {
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!win->hndl) return "";
     return RGFW_readClipboard(NULL);
 }
 
@@ -1883,6 +2191,7 @@ void gs_platform_set_cursor(uint32_t handle, gs_platform_cursor cursor)
 {
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
+    if (!win->hndl) return;
     u8 cp = (u8)platform->cursors[(u32)cursor]; 
     RGFW_window_setMouseStandard(win->hndl, cp);
 }
@@ -1892,7 +2201,7 @@ void gs_platform_lock_mouse(uint32_t handle, bool32_t lock)
     __gs_input()->mouse.locked = lock;
     gs_platform_t* platform = gs_subsystem(platform);
     gs_platform_window_t* win = gs_slot_array_getp(gs_subsystem(platform)->windows, handle);
-
+    if (!win->hndl) return;
     RGFW_window_showMouse((RGFW_window*)win->hndl, !lock);
     // Not sure if I want to support this or not
     // if (glfwRawMouseMotionSupported()) {
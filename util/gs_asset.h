@@ -54,7 +54,7 @@ typedef struct gs_asset_s
 GS_API_DECL gs_asset_t __gs_asset_handle_create_impl(uint64_t type_id, uint32_t asset_id, uint32_t importer_id);
 
 #define gs_asset_handle_create(T, ID, IMPID)\
-	__gs_asset_handle_create_impl(gs_hash_str64(gs_to_str(T)), ID, IMPID)
+	__gs_asset_handle_create_impl(gs_type_id(T), ID, IMPID)
 
 typedef void (* gs_asset_load_func)(const char *,void *,...);
 typedef gs_asset_t (* gs_asset_default_func)(void *);
@@ -62,6 +62,7 @@ typedef gs_asset_t (* gs_asset_default_func)(void *);
 typedef struct gs_asset_importer_desc_t {
 	void (* load_from_file)(const char* path, void* out, ...);
 	gs_asset_t (* default_asset)(void* out);
+	bool (* reload)(const char* path, void* out);	// Optional, reloads changed file into existing asset (see gs_asset_manager_t.hot_reload)
 } gs_asset_importer_desc_t;
 
 typedef struct gs_asset_importer_t 
@@ -82,7 +83,7 @@ GS_API_DECL gs_asset_t gs_asset_default_asset();
 GS_API_DECL void gs_asset_importer_set_desc(gs_asset_importer_t* imp, gs_asset_importer_desc_t* desc);
 
 #define gs_assets_get_importerp(AM, T)\
-	(gs_hash_table_getp((AM)->importers, gs_hash_str64(gs_to_str(T))))
+	(gs_hash_table_getp((AM)->importers, gs_type_id(T)))
 
 #ifdef __cplusplus
 	#define gsa_imsa(IMPORTER, T)\
@@ -108,41 +109,53 @@ GS_API_DECL void gs_asset_importer_set_desc(gs_asset_importer_t* imp, gs_asset_i
 		ai.slot_array_indices_ptr = (void*)sa->indices;\
 		ai.slot_array_data_ptr = (void*)sa->data;\
 		if (!ai.desc.load_from_file) {ai.desc.load_from_file = (gs_asset_load_func)&gs_asset_default_load_from_file;}\
-		gs_hash_table_insert((AM)->importers, gs_hash_str64(gs_to_str(T)), ai);\
+		gs_hash_table_insert((AM)->importers, gs_type_id(T), ai);\
 	} while(0)
 
 // Need a way to be able to print upon assert
 #define gs_assets_load_from_file(AM, T, PATH, ...)\
 	(\
-		/*gs_assert(gs_hash_table_key_exists((AM)->importers, gs_hash_str64(gs_to_str(T)))),*/\
-		(AM)->tmpi = gs_hash_table_getp((AM)->importers, gs_hash_str64(gs_to_str(T))),\
-		(AM)->tmpi->desc.load_from_file(PATH, (AM)->tmpi->tmp_ptr, ## __VA_ARGS__),\
+		/*gs_assert(gs_hash_table_key_exists((AM)->importers, gs_type_id(T))),*/\
+		(AM)->tmp_path = (PATH),\
+		(AM)->tmpi = gs_hash_table_getp((AM)->importers, gs_type_id(T)),\
+		(AM)->tmpi->desc.load_from_file((AM)->tmp_path, (AM)->tmpi->tmp_ptr, ## __VA_ARGS__),\
 		(AM)->tmpi->tmpid = gs_slot_array_insert_func(&(AM)->tmpi->slot_array_indices_ptr, &(AM)->tmpi->slot_array_data_ptr, (AM)->tmpi->tmp_ptr, (AM)->tmpi->data_size, NULL),\
-		gs_asset_handle_create(T, (AM)->tmpi->tmpid, (AM)->tmpi->importer_id)\
+		__gs_assets_watch_impl((AM), (AM)->tmp_path, gs_asset_handle_create(T, (AM)->tmpi->tmpid, (AM)->tmpi->importer_id))\
 	)
 
 #define gs_assets_create_asset(AM, T, DATA)\
 	(\
-		/*gs_assert(gs_hash_table_key_exists((AM)->importers, gs_hash_str64(gs_to_str(T)))),*/\
-		(AM)->tmpi = gs_hash_table_getp((AM)->importers, gs_hash_str64(gs_to_str(T))),\
+		/*gs_assert(gs_hash_table_key_exists((AM)->importers, gs_type_id(T))),*/\
+		(AM)->tmpi = gs_hash_table_getp((AM)->importers, gs_type_id(T)),\
 		(AM)->tmpi->tmp_ptr = (DATA),\
 		(AM)->tmpi->tmpid = gs_slot_array_insert_func(&(AM)->tmpi->slot_array_indices_ptr, &(AM)->tmpi->slot_array_data_ptr, (AM)->tmpi->tmp_ptr, (AM)->tmpi->data_size, NULL),\
 		gs_asset_handle_create(T, (AM)->tmpi->tmpid, (AM)->tmpi->importer_id)\
 	)
 
+typedef struct gs_asset_watch_t
+{
+	struct gs_asset_manager_t* am;
+	gs_asset_t hndl;
+	uint32_t watch;											// File watch handle
+} gs_asset_watch_t;
+
 typedef struct gs_asset_manager_t
 {
 	gs_hash_table(uint64_t, gs_asset_importer_t) importers;	// Maps hashed types to importer
 	gs_asset_importer_t* tmpi;								// Temporary importer for caching 
+	const char* tmp_path;									// Temporary path, evaluated once per load
 	uint32_t free_importer_id;
+	bool32_t hot_reload;									// Watch files loaded from here on, reloading changed ones (manager address must stay fixed)
+	gs_dyn_array(gs_asset_watch_t*) watches;
 } gs_asset_manager_t;
 
 GS_API_DECL gs_asset_manager_t gs_asset_manager_new();
 GS_API_DECL void gs_asset_manager_free(gs_asset_manager_t* am);
 GS_API_DECL void* __gs_assets_getp_impl(gs_asset_manager_t* am, uint64_t type_id, gs_asset_t hndl);
+GS_API_DECL gs_asset_t __gs_assets_watch_impl(gs_asset_manager_t* am, const char* path, gs_asset_t hndl);
 
 #define gs_assets_getp(AM, T, HNDL)\
-	(T*)(__gs_assets_getp_impl(AM, gs_hash_str64(gs_to_str(T)), HNDL))
+	(T*)(__gs_assets_getp_impl(AM, gs_type_id(T), HNDL))
 
 #define gs_assets_get(AM, T, HNDL)\
 	*(gs_assets_getp(AM, T, HNDL));
@@ -166,6 +179,9 @@ gs_asset_manager_t gs_asset_manager_new()
 {
 	gs_asset_manager_t assets = gs_default_val();
 
+	// Keys are type ids, no need for a flood-resistant hash
+	gs_hash_table_set_hash_func(assets.importers, uint64_t, gs_asset_importer_t, gs_hash_bytes_fast);
+
 	// Register default asset importers
 	gs_asset_importer_desc_t tex_desc   = gs_default_val();
 	gs_asset_importer_desc_t font_desc  = gs_default_val();
@@ -174,6 +190,7 @@ gs_asset_manager_t gs_asset_manager_new()
 	gs_asset_importer_desc_t asset_desc  = gs_default_val();
 
 	tex_desc.load_from_file = (gs_asset_load_func)&gs_asset_texture_load_from_file;
+	tex_desc.reload = &gs_asset_texture_reload;
 	font_desc.load_from_file = (gs_asset_load_func)&gs_asset_font_load_from_file;
 	audio_desc.load_from_file = (gs_asset_load_func)&gs_asset_audio_load_from_file;
 	mesh_desc.load_from_file = (gs_asset_load_func)&gs_asset_mesh_load_from_file;
@@ -190,6 +207,37 @@ gs_asset_manager_t gs_asset_manager_new()
 void gs_asset_manager_free(gs_asset_manager_t* am)
 {
 	// Free all data	
+	for (uint32_t i = 0; i < gs_dyn_array_size(am->watches); ++i) {
+		gs_platform_file_unwatch(am->watches[i]->watch);
+		gs_free(am->watches[i]);
+	}
+	gs_dyn_array_free(am->watches);
+	am->watches = NULL;
+}
+
+GS_API_PRIVATE void __gs_assets_reload_cb(const char* path, gs_platform_file_watch_event evt, void* user_data)
+{
+	gs_asset_watch_t* aw = (gs_asset_watch_t*)user_data;
+	if (evt != GS_PLATFORM_FILE_WATCH_MODIFIED) return;
+
+	gs_asset_importer_t* imp = gs_hash_table_getp(aw->am->importers, aw->hndl.type_id);
+	void* asset = __gs_assets_getp_impl(aw->am, aw->hndl.type_id, aw->hndl);
+	if (!imp->desc.reload(path, asset)) {
+		gs_log_warning("Failed to reload asset: %s", path);
+	}
+}
+
+gs_asset_t __gs_assets_watch_impl(gs_asset_manager_t* am, const char* path, gs_asset_t hndl)
+{
+	if (!am->hot_reload || !gs_hash_table_key_exists(am->importers, hndl.type_id)) return hndl;
+	if (!gs_hash_table_getp(am->importers, hndl.type_id)->desc.reload) return hndl;
+
+	gs_asset_watch_t* aw = (gs_asset_watch_t*)gs_malloc(sizeof(gs_asset_watch_t));
+	aw->am = am;
+	aw->hndl = hndl;
+	aw->watch = gs_platform_file_watch(path, __gs_assets_reload_cb, aw);
+	gs_dyn_array_push(am->watches, aw);
+	return hndl;
 }
 
 void* __gs_assets_getp_impl(gs_asset_manager_t* am, uint64_t type_id, gs_asset_t hndl)
@@ -114,6 +114,19 @@
     #define GS_GFXT_UNIFORM_TIME "U_TIME"
 #endif
 
+// Packed uniforms: plain (non-opaque) uniforms live in one std140 block, bound with a single ranged uniform buffer bind per draw
+#ifndef GS_GFXT_UNIFORM_BLOCKS
+    #define GS_GFXT_UNIFORM_BLOCKS 0                    // Set to 1 for .sf pipelines to generate and use the block
+#endif
+
+#ifndef GS_GFXT_UNIFORM_BLOCK_NAME
+    #define GS_GFXT_UNIFORM_BLOCK_NAME "gs_gfxt_uniforms"
+#endif
+
+#ifndef GS_GFXT_UNIFORM_BLOCK_BINDING
+    #define GS_GFXT_UNIFORM_BLOCK_BINDING 0
+#endif
+
 typedef void* (*gs_gfxt_raw_data_func)(GS_GFXT_HNDL hndl, void* user_data);
 
 #define GS_GFXT_RAW_DATA(FUNC_DESC, T)\
@@ -141,11 +154,14 @@ typedef struct gs_gfxt_uniform_t {
     size_t size;                                    // Size of this uniform data in bytes
     gs_graphics_uniform_type type;                  // Type of this uniform
     gs_graphics_access_type access_type;            // Access type of uniform (compute only)
+    bool32 packed;                                  // Lives in the block's uniform buffer instead of having a handle
+    uint32_t block_offset;                          // std140 offset in the packed block
 } gs_gfxt_uniform_t;
 
 typedef struct gs_gfxt_uniform_block_desc_t {
     gs_gfxt_uniform_desc_t* layout;                 // Layout for all uniform data for this block to hold
     size_t size;                                    // Size of layout in bytes
+    bool32 packed;                                  // Pack plain uniforms into GS_GFXT_UNIFORM_BLOCK_NAME, declared std140 in layout order
 } gs_gfxt_uniform_block_desc_t;
 
 typedef struct gs_gfxt_uniform_block_lookup_key_t {
@@ -156,6 +172,9 @@ typedef struct gs_gfxt_uniform_block_t {
     gs_dyn_array(gs_gfxt_uniform_t) uniforms;    // Raw uniform handle array
     gs_hash_table(uint64_t, uint32_t) lookup;    // Index lookup table (used for byte buffer offsets in material uni. data)
     size_t size;                                 // Total size of material data for entire block
+    gs_handle(gs_graphics_uniform_buffer_t) ubo; // Packed uniforms, streamed per draw
+    size_t packed_size;                          // std140 size of packed uniforms
+    uint8_t* packed;                             // Scratch for packing material data
 } gs_gfxt_uniform_block_t; 
 
 //=== Texture ===//
@@ -298,6 +317,8 @@ GS_API_DECL gs_gfxt_mesh_t          gs_gfxt_mesh_create(const gs_gfxt_mesh_desc_
 GS_API_DECL void                    gs_gfxt_mesh_update_or_create(gs_gfxt_mesh_t* mesh, const gs_gfxt_mesh_desc_t* desc);
 GS_API_DECL gs_gfxt_renderable_t    gs_gfxt_renderable_create(const gs_gfxt_renderable_desc_t* desc);
 GS_API_DECL gs_gfxt_uniform_block_t gs_gfxt_uniform_block_create(const gs_gfxt_uniform_block_desc_t* desc);
+GS_API_DECL bool gs_gfxt_uniform_type_packable(gs_graphics_uniform_type type);                     // Can live in a std140 block
+GS_API_DECL uint32_t gs_gfxt_uniform_std140_size(gs_graphics_uniform_type type, uint32_t* align);
 GS_API_DECL gs_gfxt_texture_t       gs_gfxt_texture_create(gs_graphics_texture_desc_t* desc); 
 
 //=== Destruction ===// 
@@ -309,6 +330,8 @@ GS_API_DECL void gs_gfxt_pipeline_destroy(gs_gfxt_pipeline_t* pipeline);
 
 //=== Resource Loading ===//
 GS_API_DECL gs_gfxt_pipeline_t gs_gfxt_pipeline_load_from_file(const char* path);
+GS_API_DECL bool gs_gfxt_pipeline_reload(gs_gfxt_pipeline_t* pip, const char* path);     // Replaces pip in place, keeps old pipeline on failure
+GS_API_DECL uint32_t gs_gfxt_pipeline_watch(gs_gfxt_pipeline_t* pip, const char* path);  // Reloads pip when file changes, returns file watch handle
 GS_API_DECL gs_gfxt_pipeline_t gs_gfxt_pipeline_load_from_memory(const char* data, size_t sz);
 GS_API_DECL gs_gfxt_pipeline_t gs_gfxt_pipeline_load_from_memory_ext(const char* data, size_t sz, const char* file_dir);
 GS_API_DECL gs_gfxt_texture_t  gs_gfxt_texture_load_from_file(const char* path, gs_graphics_texture_desc_t* desc, bool flip, bool keep_data);
@@ -376,10 +399,17 @@ gs_gfxt_uniform_block_create(const gs_gfxt_uniform_block_desc_t* desc)
     // Iterate through layout, construct uniforms, place them into hash table
     uint32_t offset = 0;
     uint32_t image2D_offset = 0;
+    uint32_t block_offset = 0;
     uint32_t ct = desc->size / sizeof(gs_gfxt_uniform_desc_t);
     for (uint32_t i = 0; i < ct; ++i)
     {
         gs_gfxt_uniform_desc_t* ud = &desc->layout[i];
+        const bool packed = desc->packed && gs_gfxt_uniform_type_packable(ud->type);
+
+        // Uniforms shared between stages are a single block member
+        if (packed && gs_hash_table_exists(block.lookup, gs_hash_str64(ud->name))) {
+            continue;
+        }
 
         gs_gfxt_uniform_t u = gs_default_val();
         gs_graphics_uniform_desc_t u_desc = gs_default_val();
@@ -400,7 +430,16 @@ gs_gfxt_uniform_block_create(const gs_gfxt_uniform_block_desc_t* desc)
 
             default:
             {
-                u.hndl = gs_graphics_uniform_create(&u_desc);
+                if (packed) {
+                    uint32_t align = 0;
+                    uint32_t sz = gs_gfxt_uniform_std140_size(ud->type, &align);
+                    block_offset = (block_offset + align - 1) / align * align;
+                    u.packed = true;
+                    u.block_offset = block_offset;
+                    block_offset += sz;
+                } else {
+                    u.hndl = gs_graphics_uniform_create(&u_desc);
+                }
                 u.offset = offset;
             } break; 
         }
@@ -429,9 +468,54 @@ gs_gfxt_uniform_block_create(const gs_gfxt_uniform_block_desc_t* desc)
     }
     block.size = offset;
 
+    // Uniform buffer for packed members, rounded to a vec4 as std140 blocks are
+    if (block_offset)
+    {
+        char name[64] = GS_GFXT_UNIFORM_BLOCK_NAME;
+        block.packed_size = (block_offset + 15) / 16 * 16;
+        block.packed = (uint8_t*)gs_malloc(block.packed_size);
+        memset(block.packed, 0, block.packed_size);
+
+        gs_graphics_uniform_buffer_desc_t ub_desc = gs_default_val();
+        ub_desc.name = name;
+        ub_desc.size = block.packed_size;
+        ub_desc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM;
+        block.ubo = gs_graphics_uniform_buffer_create(&ub_desc);
+    }
+
     return block;
 }
 
+GS_API_DECL bool 
+gs_gfxt_uniform_type_packable(gs_graphics_uniform_type type)
+{
+    switch (type)
+    {
+        case GS_GRAPHICS_UNIFORM_FLOAT:
+        case GS_GRAPHICS_UNIFORM_INT:
+        case GS_GRAPHICS_UNIFORM_VEC2:
+        case GS_GRAPHICS_UNIFORM_VEC3:
+        case GS_GRAPHICS_UNIFORM_VEC4:
+        case GS_GRAPHICS_UNIFORM_MAT4:  return true;
+        default:                        return false;     // Samplers and images are opaque
+    }
+}
+
+GS_API_DECL uint32_t 
+gs_gfxt_uniform_std140_size(gs_graphics_uniform_type type, uint32_t* align)
+{
+    switch (type)
+    {
+        default:
+        case GS_GRAPHICS_UNIFORM_FLOAT: *align = 4;  return sizeof(float);
+        case GS_GRAPHICS_UNIFORM_INT:   *align = 4;  return sizeof(int32_t);
+        case GS_GRAPHICS_UNIFORM_VEC2:  *align = 8;  return sizeof(gs_vec2);
+        case GS_GRAPHICS_UNIFORM_VEC3:  *align = 16; return sizeof(gs_vec3);
+        case GS_GRAPHICS_UNIFORM_VEC4:  *align = 16; return sizeof(gs_vec4);
+        case GS_GRAPHICS_UNIFORM_MAT4:  *align = 16; return sizeof(gs_mat4);
+    }
+}
+
 GS_API_DECL gs_gfxt_texture_t 
 gs_gfxt_texture_create(gs_graphics_texture_desc_t* desc)
 {
@@ -953,9 +1037,11 @@ gs_gfxt_uniform_block_destroy(gs_gfxt_uniform_block_t* ub)
     for (uint32_t i = 0; i < gs_dyn_array_size(ub->uniforms); ++i)
     {
         gs_gfxt_uniform_t* u = &ub->uniforms[i];
-        gs_graphics_uniform_destroy(u->hndl);
+        if (u->hndl.id) gs_graphics_uniform_destroy(u->hndl);
     }
 
+    if (ub->ubo.id) gs_graphics_uniform_buffer_destroy(ub->ubo);
+    if (ub->packed) gs_free(ub->packed);
     gs_dyn_array_free(ub->uniforms);
     gs_hash_table_free(ub->lookup);
 }
@@ -1105,6 +1191,13 @@ void gs_gfxt_material_bind_uniforms(gs_command_buffer_t* cb, gs_gfxt_material_t*
 
             default:
             {
+                // Copied into the block below
+                if (u->packed) {
+                    uint32_t align = 0;
+                    memcpy(pip->ublock.packed + u->block_offset, mat->uniform_data.data + u->offset, gs_gfxt_uniform_std140_size(u->type, &align));
+                    break;
+                }
+
                 gs_graphics_bind_uniform_desc_t uniforms[1];
                 uniforms[0].uniform = u->hndl;
                 uniforms[0].data = (mat->uniform_data.data + u->offset);
@@ -1116,6 +1209,24 @@ void gs_gfxt_material_bind_uniforms(gs_command_buffer_t* cb, gs_gfxt_material_t*
         }
 
     }
+
+    // Packed uniforms are streamed and bound as one range
+    if (pip->ublock.ubo.id)
+    {
+        gs_graphics_uniform_buffer_desc_t ub_desc = gs_default_val();
+        ub_desc.data = pip->ublock.packed;
+        ub_desc.size = pip->ublock.packed_size;
+        ub_desc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM;
+        gs_graphics_uniform_buffer_request_update(cb, pip->ublock.ubo, &ub_desc);
+
+        gs_graphics_bind_uniform_buffer_desc_t ubuffer[1] = gs_default_val();
+        ubuffer[0].buffer = pip->ublock.ubo;
+        ubuffer[0].binding = GS_GFXT_UNIFORM_BLOCK_BINDING;
+        gs_graphics_bind_desc_t bind = gs_default_val();
+        bind.uniform_buffers.desc = ubuffer;
+        bind.uniform_buffers.size = sizeof(ubuffer);
+        gs_graphics_apply_bindings(cb, &bind);
+    }
 }
 
 // Mesh API
@@ -1330,8 +1441,7 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
 {
     // Use cgltf like a boss
     cgltf_options cgltf_options = gs_default_val();
-    size_t len = 0;
-    char* file_data = NULL;
+    gs_platform_file_map_t map = gs_default_val();
 
     // Get file extension from path
     gs_transient_buffer(file_ext, 32);
@@ -1339,12 +1449,12 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
 
     // GLTF
     if (gs_string_compare_equal(file_ext, "gltf")) {
-        file_data = gs_platform_read_file_contents(path, "rb", &len);
+        map = gs_platform_file_map(path);
         gs_println("GFXT:Loading GLTF: %s", path);
     }
     // GLB
     else if (gs_string_compare_equal(file_ext, "glb")) {
-        file_data = gs_platform_read_file_contents(path, "rb", &len);
+        map = gs_platform_file_map(path);
         gs_println("GFXT:Loading GLTF: %s", path);
     }
     else {
@@ -1352,13 +1462,14 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
         return false;
     }
 
+    // Parsed data references the view (glb binary chunk), so keep it mapped until cgltf_free()
     cgltf_data* data = NULL;
-    cgltf_result result = cgltf_parse(&cgltf_options, file_data, (cgltf_size)len, &data);
-    gs_free(file_data);
+    cgltf_result result = cgltf_parse(&cgltf_options, map.data, (cgltf_size)map.size, &data);
 
     if (result != cgltf_result_success) {
         gs_println("GFXT:Mesh:LoadFromFile:Failed load gltf");
         cgltf_free(data);
+        gs_platform_file_unmap(&map);
         return false;
     }
 
@@ -1366,6 +1477,7 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
     result = cgltf_load_buffers(&cgltf_options, data, path);
     if (result != cgltf_result_success) {
         cgltf_free(data);
+        gs_platform_file_unmap(&map);
         gs_println("GFXT:Mesh:LoadFromFile:Failed to load buffers");
         return false;
     }
@@ -1865,6 +1977,7 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
 
     // Free all data at the end
     cgltf_free(data);
+    gs_platform_file_unmap(&map);
     gs_dyn_array_free(positions);
     gs_dyn_array_free(normals);
     gs_dyn_array_free(tangents);
@@ -3244,7 +3357,7 @@ char* gs_pipeline_generate_shader_code(gs_gfxt_pipeline_desc_t* pdesc, gs_ppd_t*
     if (ppd->code[sidx])
     {
         const size_t header_sz = (size_t)gs_string_length(shader_header);
-        size_t total_sz = gs_string_length(ppd->code[sidx]) + header_sz + 2048;
+        size_t total_sz = gs_string_length(ppd->code[sidx]) + header_sz + 2048 + 128 * gs_dyn_array_size(pdesc->ublock_desc.layout);
         src = (char*)gs_malloc(total_sz); 
         memset(src, 0, total_sz);
         strncat(src, shader_header, header_sz);
@@ -3266,12 +3379,39 @@ char* gs_pipeline_generate_shader_code(gs_gfxt_pipeline_desc_t* pdesc, gs_ppd_t*
         // Compute shader image buffer binding
         uint32_t img_binding = 0;
 
+        // Packed uniforms from every stage, so all stages declare an identical block
+        if (pdesc->ublock_desc.packed)
+        {
+            bool open = false;
+            for (uint32_t i = 0; i < gs_dyn_array_size(pdesc->ublock_desc.layout); ++i)
+            {
+                gs_gfxt_uniform_desc_t* udesc = &pdesc->ublock_desc.layout[i];
+                if (!gs_gfxt_uniform_type_packable(udesc->type)) continue;
+
+                // Uniforms shared between stages are declared once
+                bool dup = false;
+                for (uint32_t j = 0; j < i && !dup; ++j) {
+                    dup = gs_gfxt_uniform_type_packable(pdesc->ublock_desc.layout[j].type) && gs_string_compare_equal(pdesc->ublock_desc.layout[j].name, udesc->name);
+                }
+                if (dup) continue;
+
+                if (!open) {
+                    strcat(src, "layout (std140) uniform " GS_GFXT_UNIFORM_BLOCK_NAME " {\n");
+                    open = true;
+                }
+                gs_snprintfc(TMP, 128, "    %s %s;\n", gs_uniform_string_from_type(udesc->type), udesc->name);
+                strcat(src, TMP);
+            }
+            if (open) strcat(src, "};\n");
+        }
+
         // Uniforms
         for (uint32_t i = 0; i < gs_dyn_array_size(pdesc->ublock_desc.layout); ++i)
         { 
             gs_gfxt_uniform_desc_t* udesc = &pdesc->ublock_desc.layout[i]; 
 
             if (udesc->stage != stage) continue;
+            if (pdesc->ublock_desc.packed && gs_gfxt_uniform_type_packable(udesc->type)) continue;
 
             switch (stage)
             {
@@ -3393,15 +3533,44 @@ GS_API_DECL gs_gfxt_pipeline_t
 gs_gfxt_pipeline_load_from_file(const char* path)
 {
     // Load file, generate lexer off of file data, parse contents for pipeline information 
-    size_t len = 0;
-    char* file_data = gs_platform_read_file_contents(path, "rb", &len);
-    gs_assert(file_data); 
+    gs_platform_file_map_t map = gs_platform_file_map(path);
+    gs_assert(map.data); 
     gs_log_success("Parsing pipeline: %s", path);
-    gs_gfxt_pipeline_t pip = gs_gfxt_pipeline_load_from_memory_ext(file_data, len, path);
-    gs_free(file_data);
+    gs_gfxt_pipeline_t pip = gs_gfxt_pipeline_load_from_memory_ext(map.data, map.size, path);
+    gs_platform_file_unmap(&map);
     return pip;
 }
 
+GS_API_DECL bool 
+gs_gfxt_pipeline_reload(gs_gfxt_pipeline_t* pip, const char* path)
+{
+    if (!gs_platform_file_exists(path)) return false;
+
+    // Materials reference the pipeline by address, so swap contents in place
+    gs_gfxt_pipeline_t np = gs_gfxt_pipeline_load_from_file(path);
+    if (!gs_handle_is_valid(np.hndl)) {
+        gs_log_warning("Failed to reload pipeline: %s", path);
+        return false;
+    }
+    gs_gfxt_pipeline_destroy(pip);
+    *pip = np;
+    return true;
+}
+
+GS_API_PRIVATE void 
+_gs_gfxt_pipeline_watch_cb(const char* path, gs_platform_file_watch_event evt, void* user_data)
+{
+    if (evt == GS_PLATFORM_FILE_WATCH_MODIFIED) {
+        gs_gfxt_pipeline_reload((gs_gfxt_pipeline_t*)user_data, path);
+    }
+}
+
+GS_API_DECL uint32_t 
+gs_gfxt_pipeline_watch(gs_gfxt_pipeline_t* pip, const char* path)
+{
+    return gs_platform_file_watch(path, _gs_gfxt_pipeline_watch_cb, pip);
+}
+
 GS_API_DECL gs_gfxt_pipeline_t 
 gs_gfxt_pipeline_load_from_memory(const char* file_data, size_t sz)
 { 
@@ -3417,6 +3586,7 @@ gs_gfxt_pipeline_load_from_memory_ext(const char* file_data, size_t sz, const ch
     gs_ppd_t ppd = gs_default_val();
     gs_gfxt_pipeline_desc_t pdesc = gs_default_val();
     pdesc.pip_desc.raster.index_buffer_element_size = sizeof(uint32_t); 
+    pdesc.ublock_desc.packed = GS_GFXT_UNIFORM_BLOCKS;
 
     // Determine original file directory from path
     if (file_path)
@@ -3444,6 +3614,7 @@ gs_gfxt_pipeline_load_from_memory_ext(const char* file_data, size_t sz, const ch
     }
 
     gs_lexer_t lex = gs_lexer_c_ctor(file_data);
+    gs_lexer_buffer_tokens(&lex);
     while (lex.can_lex(&lex))
     {
         gs_token_t token = lex.next_token(&lex);
@@ -3456,12 +3627,14 @@ gs_gfxt_pipeline_load_from_memory_ext(const char* file_data, size_t sz, const ch
                     if (!gs_parse_pipeline(&lex, &pdesc, &ppd))
                     {
                         gs_log_warning("Unable to parse pipeline");
+                        gs_lexer_buffer_free(&lex);
                         return pip;
                     }
                 }
             } break;
         }
     }
+    gs_lexer_buffer_free(&lex);
 
     // Generate vertex shader code
     char* v_src = gs_pipeline_generate_shader_code(&pdesc, &ppd, GS_GRAPHICS_SHADER_STAGE_VERTEX); 
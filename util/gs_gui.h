@@ -3946,6 +3946,8 @@ static void gs_gui_get_split_lowest_zindex(gs_gui_context_t* ctx, gs_gui_split_t
 GS_API_DECL void 
 gs_gui_begin(gs_gui_context_t* ctx, const gs_gui_hints_t* hints)
 { 
+    gs_profile_begin("gs_gui_begin");
+
     gs_gui_hints_t default_hints = gs_default_val();
     default_hints.framebuffer_size = gs_platform_framebuffer_sizev(ctx->window_hndl);
     default_hints.viewport = gs_gui_rect(0.f, 0.f, default_hints.framebuffer_size.x, default_hints.framebuffer_size.y);
@@ -4235,6 +4237,8 @@ gs_gui_begin(gs_gui_context_t* ctx, const gs_gui_hints_t* hints)
     {
         ctx->lock_focus = 0x00;
     }
+
+    gs_profile_end();
 } 
 
 static void gs_gui_docking(gs_gui_context_t* ctx)
@@ -4400,6 +4404,8 @@ GS_API_DECL void gs_gui_end(gs_gui_context_t *ctx)
 {
 	int32_t i, n; 
 
+    gs_profile_begin("gs_gui_end");
+
     // Check for docking, draw overlays
     gs_gui_docking(ctx);
 
@@ -4740,6 +4746,8 @@ GS_API_DECL void gs_gui_end(gs_gui_context_t *ctx)
 			cnt->tail->jump.dst = ctx->command_list.items + ctx->command_list.idx;
 		}
 	}
+
+    gs_profile_end();
 } 
 
 GS_API_DECL void 
@@ -11188,9 +11196,10 @@ GS_API_DECL gs_gui_style_sheet_t gs_gui_style_sheet_load_from_memory(gs_gui_cont
         }\
     } while (0)
 
-    // Parse style sheet for styles
+    // Parse style sheet for styles (buffered, since element parsing peeks heavily)
     gs_lexer_t lex = gs_lexer_c_ctor(fd);
-    while (success && gs_lexer_c_can_lex(&lex))
+    gs_lexer_buffer_tokens(&lex);
+    while (success && lex.can_lex(&lex))
     {
         gs_token_t token = lex.next_token(&lex);
         switch (token.type)
@@ -11313,6 +11322,7 @@ GS_API_DECL gs_gui_style_sheet_t gs_gui_style_sheet_load_from_memory(gs_gui_cont
     }
 
     if (variables.variables) gs_hash_table_free(variables.variables);
+    gs_lexer_buffer_free(&lex);
 
     return ss;
 }
@@ -106,7 +106,8 @@ typedef struct gs_immediate_draw_static_data_t
 {
 	gs_handle(gs_graphics_texture_t) tex_default;
 	gs_asset_font_t font_default;
-	gs_hash_table(gsi_pipeline_state_attr_t, gs_handle(gs_graphics_pipeline_t)) pipeline_table;
+	gs_hash_table(gsi_pipeline_state_attr_t, gs_handle(gs_graphics_pipeline_t)) pipeline_table;  // Filled on first use of each state
+	gs_handle(gs_graphics_shader_t) shader;
 	gs_handle(gs_graphics_uniform_t) uniform;
 	gs_handle(gs_graphics_uniform_t) sampler; 
 	gs_handle(gs_graphics_vertex_buffer_t) vbo;
@@ -396,53 +397,7 @@ void gs_immediate_draw_static_data_init()
 	sdesc.size = sizeof(gsi_sources);
 	memcpy(sdesc.name, "gs_immediate_default_fill_shader", sizeof("gs_immediate_default_fill_shader"));
 
-	// Vertex attr layout
-    gs_graphics_vertex_attribute_desc_t gsi_vattrs[3] = gs_default_val();
-    gsi_vattrs[0].format = GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT3; memcpy(gsi_vattrs[0].name, "a_position", sizeof("a_position"));
-    gsi_vattrs[1].format = GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT2; memcpy(gsi_vattrs[1].name, "a_uv", sizeof("a_uv"));
-    gsi_vattrs[2].format = GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE4;  memcpy(gsi_vattrs[2].name, "a_color", sizeof("a_color"));
-
-	// Iterate through attribute list, then create custom pipelines requested.
-	gs_handle(gs_graphics_shader_t) shader = gs_graphics_shader_create(&sdesc);
-
-	// Pipelines
-	for (uint16_t d = 0; d < 2; ++d) // Depth
-		for (uint16_t s = 0; s < 2; ++s) // Stencil
-			for (uint16_t b = 0; b < 2; ++b) // Blend
-				for (uint16_t f = 0; f < 2; ++f) // Face Cull
-					for (uint16_t p = 0; p < 2; ++p) // Prim Type
-	{
-		gsi_pipeline_state_attr_t attr = gs_default_val();
-
-		attr.depth_enabled 		= d;
-		attr.stencil_enabled 	= s;
-		attr.blend_enabled 		= b;
-		attr.face_cull_enabled  = f;
-		attr.prim_type 			= p ? (uint16_t)GS_GRAPHICS_PRIMITIVE_TRIANGLES : (uint16_t)GS_GRAPHICS_PRIMITIVE_LINES;
-
-		// Create new pipeline based on this arrangement
-		gs_graphics_pipeline_desc_t pdesc = gs_default_val();
-		pdesc.raster.shader = shader;
-		pdesc.raster.index_buffer_element_size = sizeof(uint16_t);
-		pdesc.raster.face_culling = attr.face_cull_enabled ? GS_GRAPHICS_FACE_CULLING_BACK : (gs_graphics_face_culling_type)0x00;
-		pdesc.raster.primitive = (gs_graphics_primitive_type)attr.prim_type; 
-		pdesc.blend.func = attr.blend_enabled ? GS_GRAPHICS_BLEND_EQUATION_ADD : (gs_graphics_blend_equation_type)0x00;
-		pdesc.blend.src = GS_GRAPHICS_BLEND_MODE_SRC_ALPHA;
-		pdesc.blend.dst = GS_GRAPHICS_BLEND_MODE_ONE_MINUS_SRC_ALPHA;
-		pdesc.depth.func = d ? GS_GRAPHICS_DEPTH_FUNC_LESS : (gs_graphics_depth_func_type)0x00;
-		pdesc.stencil.func = s ? GS_GRAPHICS_STENCIL_FUNC_ALWAYS : (gs_graphics_stencil_func_type)0x00;
-		pdesc.stencil.ref = s ? 1 : 0x00;
-		pdesc.stencil.comp_mask = s ? 0xFF : 0x00;
-		pdesc.stencil.write_mask = s ? 0xFF : 0x00;
-		pdesc.stencil.sfail = s ? GS_GRAPHICS_STENCIL_OP_KEEP : (gs_graphics_stencil_op_type)0x00; 
-		pdesc.stencil.dpfail = s ? GS_GRAPHICS_STENCIL_OP_KEEP : (gs_graphics_stencil_op_type)0x00; 
-		pdesc.stencil.dppass = s ? GS_GRAPHICS_STENCIL_OP_REPLACE : (gs_graphics_stencil_op_type)0x00; 
-		pdesc.layout.attrs = gsi_vattrs;
-		pdesc.layout.size = sizeof(gsi_vattrs);
-
-		gs_handle(gs_graphics_pipeline_t) hndl = gs_graphics_pipeline_create(&pdesc);
-		gs_hash_table_insert(GSI()->pipeline_table, attr, hndl);
-	} 
+	GSI()->shader = gs_graphics_shader_create(&sdesc);
 
 	// Create default font
 	gs_asset_font_t* f = &GSI()->font_default;
@@ -563,11 +518,49 @@ gsi_default_font()
     return NULL;
 }
 
+// Pipelines are created the first time a state combination is drawn rather than all up front
+GS_API_PRIVATE gs_handle(gs_graphics_pipeline_t) 
+gsi_pipeline_create(gsi_pipeline_state_attr_t attr)
+{
+	// Vertex attr layout
+	gs_graphics_vertex_attribute_desc_t gsi_vattrs[3] = gs_default_val();
+	gsi_vattrs[0].format = GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT3; memcpy(gsi_vattrs[0].name, "a_position", sizeof("a_position"));
+	gsi_vattrs[1].format = GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT2; memcpy(gsi_vattrs[1].name, "a_uv", sizeof("a_uv"));
+	gsi_vattrs[2].format = GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE4;  memcpy(gsi_vattrs[2].name, "a_color", sizeof("a_color"));
+
+	const bool d = attr.depth_enabled, s = attr.stencil_enabled;
+
+	// Create new pipeline based on this arrangement
+	gs_graphics_pipeline_desc_t pdesc = gs_default_val();
+	pdesc.raster.shader = GSI()->shader;
+	pdesc.raster.index_buffer_element_size = sizeof(uint16_t);
+	pdesc.raster.face_culling = attr.face_cull_enabled ? GS_GRAPHICS_FACE_CULLING_BACK : (gs_graphics_face_culling_type)0x00;
+	pdesc.raster.primitive = (gs_graphics_primitive_type)attr.prim_type; 
+	pdesc.blend.func = attr.blend_enabled ? GS_GRAPHICS_BLEND_EQUATION_ADD : (gs_graphics_blend_equation_type)0x00;
+	pdesc.blend.src = GS_GRAPHICS_BLEND_MODE_SRC_ALPHA;
+	pdesc.blend.dst = GS_GRAPHICS_BLEND_MODE_ONE_MINUS_SRC_ALPHA;
+	pdesc.depth.func = d ? GS_GRAPHICS_DEPTH_FUNC_LESS : (gs_graphics_depth_func_type)0x00;
+	pdesc.stencil.func = s ? GS_GRAPHICS_STENCIL_FUNC_ALWAYS : (gs_graphics_stencil_func_type)0x00;
+	pdesc.stencil.ref = s ? 1 : 0x00;
+	pdesc.stencil.comp_mask = s ? 0xFF : 0x00;
+	pdesc.stencil.write_mask = s ? 0xFF : 0x00;
+	pdesc.stencil.sfail = s ? GS_GRAPHICS_STENCIL_OP_KEEP : (gs_graphics_stencil_op_type)0x00; 
+	pdesc.stencil.dpfail = s ? GS_GRAPHICS_STENCIL_OP_KEEP : (gs_graphics_stencil_op_type)0x00; 
+	pdesc.stencil.dppass = s ? GS_GRAPHICS_STENCIL_OP_REPLACE : (gs_graphics_stencil_op_type)0x00; 
+	pdesc.layout.attrs = gsi_vattrs;
+	pdesc.layout.size = sizeof(gsi_vattrs);
+
+	gs_handle(gs_graphics_pipeline_t) hndl = gs_graphics_pipeline_create(&pdesc);
+	gs_hash_table_insert(GSI()->pipeline_table, attr, hndl);
+	return hndl;
+}
+
 GS_API_DECL gs_handle(gs_graphics_pipeline_t) 
 gsi_get_pipeline(gs_immediate_draw_t* gsi, gsi_pipeline_state_attr_t state)
 {
-	// Bind pipeline
-	gs_assert(gs_hash_table_key_exists(GSI()->pipeline_table, state));
+	if (!gs_hash_table_key_exists(GSI()->pipeline_table, state)) {
+		return gsi_pipeline_create(state);
+	}
 	return gs_hash_table_get(GSI()->pipeline_table, state);
 }
 
@@ -589,8 +582,7 @@ void gs_immediate_draw_set_pipeline(gs_immediate_draw_t* gsi)
 	gsi->cache.pipeline.blend_enabled = gs_clamp(gsi->cache.pipeline.blend_enabled, 0, 1);
 
 	// Bind pipeline
-	gs_assert(gs_hash_table_key_exists(GSI()->pipeline_table, gsi->cache.pipeline));
-	gs_graphics_pipeline_bind(&gsi->commands, gs_hash_table_get(GSI()->pipeline_table, gsi->cache.pipeline));
+	gs_graphics_pipeline_bind(&gsi->commands, gsi_get_pipeline(gsi, gsi->cache.pipeline));
 }
 
 /* Core Vertex Functions */
@@ -646,6 +638,8 @@ void gsi_flush(gs_immediate_draw_t* gsi)
 		return;
 	}
 
+	gs_profile_begin("gsi_flush");
+
 	// Set up mvp matrix
 	gs_mat4 mv = gsi->cache.modelview[gs_dyn_array_size(gsi->cache.modelview) - 1];
 	gs_mat4 proj = gsi->cache.projection[gs_dyn_array_size(gsi->cache.projection) - 1];
@@ -710,6 +704,8 @@ void gsi_flush(gs_immediate_draw_t* gsi)
 
 	// Clear data
 	gs_byte_buffer_clear(&gsi->vertices);
+
+	gs_profile_end();
 }
 
 // Core pipeline functions
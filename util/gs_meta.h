@@ -203,7 +203,7 @@ GS_API_DECL void gs_meta_class_unregister(gs_meta_registry_t* meta, uint64_t id)
 GS_API_DECL uint64_t gs_meta_enum_register(gs_meta_registry_t* meta, const gs_meta_enum_decl_t* decl); 
 
 #define gs_meta_class_get(META, T)\
-    (gs_hash_table_getp((META)->classes, gs_hash_str64(gs_to_str(T))))
+    (gs_hash_table_getp((META)->classes, gs_type_id(T)))
 
 #define gs_meta_class_get_w_name(META, NAME)\
 	(gs_hash_table_getp((META)->classes, gs_hash_str64(NAME)))